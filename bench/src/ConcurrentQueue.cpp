@@ -0,0 +1,130 @@
+#include <NazaraUtils/MPMCQueue.hpp>
+#include <NazaraUtils/SPSCQueue.hpp>
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <nanobench.h>
+
+constexpr std::size_t ElementCount = 1'000'000;
+constexpr std::size_t QueueCapacity = 1024;
+constexpr std::size_t BatchSize = 32;
+
+class MutexDeque
+{
+	public:
+		bool TryPush(std::size_t value)
+		{
+			std::lock_guard lock(m_mutex);
+			if (m_deque.size() >= QueueCapacity)
+				return false;
+
+			m_deque.push_back(value);
+			return true;
+		}
+
+		bool TryPop(std::size_t& value)
+		{
+			std::lock_guard lock(m_mutex);
+			if (m_deque.empty())
+				return false;
+
+			value = m_deque.front();
+			m_deque.pop_front();
+			return true;
+		}
+
+	private:
+		std::deque<std::size_t> m_deque;
+		std::mutex m_mutex;
+};
+
+template<typename Queue>
+void TestTransfer(ankerl::nanobench::Bench& bench, const std::string& name)
+{
+	bench.run(name, [&]
+	{
+		Queue queue;
+		std::thread producer([&]
+		{
+			for (std::size_t i = 0; i < ElementCount; ++i)
+			{
+				while (!queue.TryPush(i))
+					std::this_thread::yield();
+			}
+		});
+
+		std::size_t sum = 0;
+		for (std::size_t i = 0; i < ElementCount; ++i)
+		{
+			std::size_t value;
+			while (!queue.TryPop(value))
+				std::this_thread::yield();
+
+			sum += value;
+		}
+
+		producer.join();
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+template<typename Queue>
+void TestBatchTransfer(ankerl::nanobench::Bench& bench, const std::string& name)
+{
+	bench.run(name, [&]
+	{
+		Queue queue;
+		std::thread producer([&]
+		{
+			std::array<std::size_t, BatchSize> batch;
+			std::size_t nextValue = 0;
+			while (nextValue < ElementCount)
+			{
+				for (std::size_t i = 0; i < BatchSize; ++i)
+					batch[i] = nextValue + i;
+
+				std::size_t pushed = queue.TryPushN(batch.begin(), std::min(BatchSize, ElementCount - nextValue));
+				if (pushed == 0)
+					std::this_thread::yield();
+
+				nextValue += pushed;
+			}
+		});
+
+		std::size_t sum = 0;
+		std::size_t received = 0;
+		std::array<std::size_t, BatchSize> batch;
+		while (received < ElementCount)
+		{
+			std::size_t count = queue.TryPopN(batch.begin(), BatchSize);
+			if (count == 0)
+				std::this_thread::yield();
+
+			for (std::size_t i = 0; i < count; ++i)
+				sum += batch[i];
+
+			received += count;
+		}
+
+		producer.join();
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+}
+
+int main()
+{
+	ankerl::nanobench::Bench bench;
+	bench.title("Transferring one million integers between two threads");
+	bench.unit("element");
+	bench.batch(ElementCount);
+	bench.minEpochIterations(5);
+
+	TestTransfer<MutexDeque>(bench, "std::mutex + std::deque");
+	TestTransfer<Nz::SPSCQueue<std::size_t, QueueCapacity>>(bench, "Nz::SPSCQueue");
+	TestTransfer<Nz::MPMCQueue<std::size_t, QueueCapacity>>(bench, "Nz::MPMCQueue");
+	TestBatchTransfer<Nz::SPSCQueue<std::size_t, QueueCapacity>>(bench, "Nz::SPSCQueue (batches of 32)");
+	TestBatchTransfer<Nz::MPMCQueue<std::size_t, QueueCapacity>>(bench, "Nz::MPMCQueue (batches of 32)");
+}
@@ -0,0 +1,61 @@
+#include <NazaraUtils/FixedVector.hpp>
+#include <memory>
+#include <string>
+#include <nanobench.h>
+
+namespace
+{
+	// Same layout as std::unique_ptr but without the trivially relocatable opt-in
+	struct NonRelocatablePtr
+	{
+		NonRelocatablePtr() = default;
+		NonRelocatablePtr(NonRelocatablePtr&&) noexcept = default;
+		~NonRelocatablePtr() = default;
+
+		NonRelocatablePtr& operator=(NonRelocatablePtr&&) noexcept = default;
+
+		std::unique_ptr<int> ptr;
+	};
+}
+
+template<typename T>
+void TestShifting(ankerl::nanobench::Bench& bench, const std::string& name)
+{
+	constexpr std::size_t ElementCount = 200;
+
+	Nz::FixedVector<T, ElementCount + 1> vec;
+	for (std::size_t i = 0; i < ElementCount; ++i)
+		vec.emplace_back();
+
+	bench.run(name + " insert/erase at front", [&] {
+		vec.emplace(vec.begin());
+		vec.erase(vec.begin());
+		ankerl::nanobench::doNotOptimizeAway(vec);
+	});
+}
+
+template<typename T>
+void TestSpilling(ankerl::nanobench::Bench& bench, const std::string& name)
+{
+	constexpr std::size_t InlineCapacity = 64;
+
+	bench.run(name + " spill to fallback", [&] {
+		Nz::HybridVector<T, InlineCapacity> vec;
+		for (std::size_t i = 0; i < InlineCapacity + 1; ++i)
+			vec.emplace_back();
+
+		ankerl::nanobench::doNotOptimizeAway(vec);
+	});
+}
+
+int main()
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10'000);
+	bench.title("Trivially relocatable fast paths");
+
+	TestShifting<std::unique_ptr<int>>(bench, "std::unique_ptr (relocatable)");
+	TestShifting<NonRelocatablePtr>(bench, "non-relocatable pointer");
+	TestSpilling<int>(bench, "int (trivially copyable)");
+	TestSpilling<NonRelocatablePtr>(bench, "non-relocatable pointer");
+}
@@ -0,0 +1,51 @@
+#include <NazaraUtils/FlatMap.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nanobench.h>
+
+template<typename Map>
+void TestLookup(ankerl::nanobench::Bench& bench, const std::string& name, const std::vector<Nz::UInt32>& keys, const std::vector<Nz::UInt32>& lookups)
+{
+	Map map;
+	for (Nz::UInt32 key : keys)
+		map[key] = key * 2;
+
+	std::size_t lookupIndex = 0;
+	bench.run(name, [&] {
+		auto it = map.find(lookups[lookupIndex++ % lookups.size()]);
+		ankerl::nanobench::doNotOptimizeAway(it);
+	});
+}
+
+void TestFlatMap(std::size_t keyCount)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100'000);
+	bench.title("Looking up one of " + std::to_string(keyCount) + " keys");
+
+	std::minstd_rand gen(std::random_device{}());
+	std::uniform_int_distribution<Nz::UInt32> dis(0, Nz::UInt32(keyCount * 4));
+
+	std::vector<Nz::UInt32> keys(keyCount);
+	for (Nz::UInt32& key : keys)
+		key = dis(gen);
+
+	std::vector<Nz::UInt32> lookups(1024);
+	for (Nz::UInt32& key : lookups)
+		key = dis(gen);
+
+	TestLookup<std::map<Nz::UInt32, Nz::UInt32>>(bench, "std::map", keys, lookups);
+	TestLookup<std::unordered_map<Nz::UInt32, Nz::UInt32>>(bench, "std::unordered_map", keys, lookups);
+	TestLookup<Nz::HybridFlatMap<Nz::UInt32, Nz::UInt32, 32>>(bench, "Nz::HybridFlatMap", keys, lookups);
+}
+
+int main()
+{
+	TestFlatMap(8);
+	TestFlatMap(16);
+	TestFlatMap(32);
+	TestFlatMap(256);
+}
@@ -0,0 +1,54 @@
+#include <NazaraUtils/Hash.hpp>
+#include <random>
+#include <vector>
+#include <nanobench.h>
+
+constexpr std::size_t BufferSize = 1024 * 1024;
+
+int main()
+{
+	std::mt19937 randomEngine(42);
+	std::vector<Nz::UInt8> data(BufferSize);
+	for (Nz::UInt8& byte : data)
+		byte = static_cast<Nz::UInt8>(randomEngine());
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Hashing 1MiB");
+	bench.unit("byte");
+	bench.batch(BufferSize);
+	bench.minEpochIterations(20);
+
+	bench.run("CRC32 (byte-wise table)", [&]
+	{
+		Nz::UInt32 crc = 0xFFFFFFFFu;
+		for (Nz::UInt8 byte : data)
+			crc = Nz::Detail::s_crc32Table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+
+		ankerl::nanobench::doNotOptimizeAway(~crc);
+	});
+
+	bench.run("CRC32 (slicing-by-16)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(~Nz::Detail::UpdateCRC32Slicing(0xFFFFFFFFu, data.data(), data.size(), Nz::Detail::GetCRC32SlicingTables<0xEDB88320>()));
+	});
+
+	bench.run("Nz::CRC32", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::CRC32(data.data(), data.size()));
+	});
+
+	bench.run("CRC32C (slicing-by-16)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(~Nz::Detail::UpdateCRC32Slicing(0xFFFFFFFFu, data.data(), data.size(), Nz::Detail::GetCRC32SlicingTables<0x82F63B78>()));
+	});
+
+	bench.run("Nz::CRC32C", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::CRC32C(data.data(), data.size()));
+	});
+
+	bench.run("Nz::FNV1a64", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::FNV1a64(data.data(), data.size()));
+	});
+}
@@ -0,0 +1,86 @@
+#include <NazaraUtils/MemoryPool.hpp>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nanobench.h>
+
+namespace
+{
+	struct Particle
+	{
+		float position[3];
+		float velocity[3];
+	};
+}
+
+void TestMemoryPool(std::size_t entryCount, float occupancy)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(10);
+	bench.title("Iterating on " + std::to_string(entryCount) + " entries with " + std::to_string(int(occupancy * 100.f)) + "% occupancy");
+
+	Nz::MemoryPool<Particle> pool(1024);
+
+	std::vector<std::size_t> indices(entryCount);
+	for (std::size_t& index : indices)
+		pool.Allocate(index, Particle{ { 0.f, 0.f, 0.f }, { 1.f, 2.f, 3.f } });
+
+	std::minstd_rand gen(std::random_device{}());
+	std::bernoulli_distribution dis(occupancy);
+	for (std::size_t index : indices)
+	{
+		if (!dis(gen))
+			pool.Free(index);
+	}
+
+	auto update = [](Particle& particle)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+			particle.position[i] += particle.velocity[i];
+	};
+
+	bench.run("range-based for", [&] {
+		for (Particle& particle : pool)
+			update(particle);
+
+		ankerl::nanobench::doNotOptimizeAway(pool);
+	});
+
+	bench.run("ForEach", [&] {
+		pool.ForEach(update);
+		ankerl::nanobench::doNotOptimizeAway(pool);
+	});
+
+	bench.run("ParallelForEach", [&] {
+		pool.ParallelForEach([](std::size_t jobCount, Nz::FunctionRef<void(std::size_t)> job)
+		{
+			std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+			std::vector<std::thread> threads;
+			for (std::size_t i = 1; i < threadCount; ++i)
+			{
+				threads.emplace_back([=]
+				{
+					for (std::size_t jobIndex = i; jobIndex < jobCount; jobIndex += threadCount)
+						job(jobIndex);
+				});
+			}
+
+			for (std::size_t jobIndex = 0; jobIndex < jobCount; jobIndex += threadCount)
+				job(jobIndex);
+
+			for (std::thread& thread : threads)
+				thread.join();
+		}, update);
+
+		ankerl::nanobench::doNotOptimizeAway(pool);
+	});
+}
+
+int main()
+{
+	TestMemoryPool(500'000, 1.f);
+	TestMemoryPool(500'000, 0.5f);
+	TestMemoryPool(500'000, 0.1f);
+}
@@ -0,0 +1,79 @@
+#include <NazaraUtils/ParallelAlgorithm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+constexpr std::size_t ElementCount = 1'000'000;
+
+int main()
+{
+	Nz::TaskScheduler scheduler;
+
+	std::vector<float> values(ElementCount);
+	std::iota(values.begin(), values.end(), 0.f);
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Processing one million floats on " + std::to_string(scheduler.GetWorkerCount()) + " workers");
+	bench.unit("element");
+	bench.batch(ElementCount);
+	bench.minEpochIterations(10);
+
+	bench.run("for loop", [&]
+	{
+		for (float& value : values)
+			value = std::sqrt(value * value + 1.f);
+
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+
+	bench.run("Nz::ParallelFor", [&]
+	{
+		Nz::ParallelFor(scheduler, values, 0, [](float& value)
+		{
+			value = std::sqrt(value * value + 1.f);
+		});
+
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+
+	bench.run("std::accumulate", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(std::accumulate(values.begin(), values.end(), 0.0));
+	});
+
+	bench.run("Nz::ParallelReduce", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::ParallelReduce(scheduler, values, 0, 0.0));
+	});
+
+	std::mt19937 randomEngine(42);
+	std::vector<Nz::UInt32> unsortedKeys(ElementCount);
+	for (Nz::UInt32& key : unsortedKeys)
+		key = randomEngine();
+
+	std::vector<Nz::UInt32> keys;
+
+	ankerl::nanobench::Bench sortBench;
+	sortBench.title("Sorting one million integers on " + std::to_string(scheduler.GetWorkerCount()) + " workers");
+	sortBench.unit("element");
+	sortBench.batch(ElementCount);
+	sortBench.minEpochIterations(5);
+
+	sortBench.run("std::sort", [&]
+	{
+		keys = unsortedKeys;
+		std::sort(keys.begin(), keys.end());
+		ankerl::nanobench::doNotOptimizeAway(keys.data());
+	});
+
+	sortBench.run("Nz::ParallelSort", [&]
+	{
+		keys = unsortedKeys;
+		Nz::ParallelSort(scheduler, keys);
+		ankerl::nanobench::doNotOptimizeAway(keys.data());
+	});
+}
@@ -0,0 +1,85 @@
+#include <NazaraUtils/Algorithm.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+constexpr std::size_t ElementCount = 1'000'000;
+
+struct DrawCall
+{
+	Nz::UInt64 renderKey;
+	Nz::UInt32 entityId;
+};
+
+template<typename T>
+void BenchSort(ankerl::nanobench::Bench& bench, const char* typeName, const std::vector<T>& unsortedValues)
+{
+	std::vector<T> values;
+	std::vector<T> buffer(unsortedValues.size());
+
+	bench.run(std::string("std::sort (") + typeName + ")", [&]
+	{
+		values = unsortedValues;
+		std::sort(values.begin(), values.end());
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+
+	bench.run(std::string("Nz::RadixSort (") + typeName + ")", [&]
+	{
+		values = unsortedValues;
+		Nz::RadixSort(values.data(), values.size(), buffer.data());
+		ankerl::nanobench::doNotOptimizeAway(values.data());
+	});
+}
+
+int main()
+{
+	std::mt19937_64 randomEngine(42);
+
+	std::vector<Nz::UInt64> uint64Keys(ElementCount);
+	for (Nz::UInt64& key : uint64Keys)
+		key = randomEngine();
+
+	std::vector<Nz::UInt32> uint32Keys(ElementCount);
+	for (Nz::UInt32& key : uint32Keys)
+		key = Nz::UInt32(randomEngine());
+
+	std::uniform_real_distribution<float> floatDis(-1000.f, 1000.f);
+	std::vector<float> floatKeys(ElementCount);
+	for (float& key : floatKeys)
+		key = floatDis(randomEngine);
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Sorting one million keys");
+	bench.unit("element");
+	bench.batch(ElementCount);
+	bench.minEpochIterations(5);
+
+	BenchSort(bench, "UInt64", uint64Keys);
+	BenchSort(bench, "UInt32", uint32Keys);
+	BenchSort(bench, "float", floatKeys);
+
+	// Render keys using only their lower 40 bits, the upper passes are skipped
+	std::vector<DrawCall> unsortedDrawCalls(ElementCount);
+	for (std::size_t i = 0; i < ElementCount; ++i)
+		unsortedDrawCalls[i] = { randomEngine() & 0xFF'FFFF'FFFF, Nz::UInt32(i) };
+
+	std::vector<DrawCall> drawCalls;
+	std::vector<DrawCall> buffer(ElementCount);
+
+	bench.run("std::stable_sort (DrawCall)", [&]
+	{
+		drawCalls = unsortedDrawCalls;
+		std::stable_sort(drawCalls.begin(), drawCalls.end(), [](const DrawCall& lhs, const DrawCall& rhs) { return lhs.renderKey < rhs.renderKey; });
+		ankerl::nanobench::doNotOptimizeAway(drawCalls.data());
+	});
+
+	bench.run("Nz::RadixSort (DrawCall)", [&]
+	{
+		drawCalls = unsortedDrawCalls;
+		Nz::RadixSort(drawCalls.data(), drawCalls.size(), buffer.data(), &DrawCall::renderKey);
+		ankerl::nanobench::doNotOptimizeAway(drawCalls.data());
+	});
+}
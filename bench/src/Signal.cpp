@@ -0,0 +1,188 @@
+#include <NazaraUtils/ConcurrentSignal.hpp>
+#include <NazaraUtils/QueuedSignal.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <array>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+struct Listener
+{
+	void OnEvent(int value)
+	{
+		total += value;
+	}
+
+	int total = 0;
+};
+
+void BenchEmit()
+{
+	ankerl::nanobench::Bench bench;
+	bench.title("Emitting a signal");
+	bench.unit("emit");
+	bench.minEpochIterations(1000);
+
+	for (std::size_t slotCount : { 0, 1, 4, 64, 1024 })
+	{
+		Nz::Signal<int> signal;
+
+		int total = 0;
+		for (std::size_t i = 0; i < slotCount; ++i)
+			signal.Connect([&total](int value) { total += value; });
+
+		bench.run("emit (" + std::to_string(slotCount) + " slots)", [&]
+		{
+			signal(1);
+			ankerl::nanobench::doNotOptimizeAway(total);
+		});
+	}
+
+	std::ofstream output("bench-Signal-emit.json");
+	ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, output);
+}
+
+void BenchSlotKinds()
+{
+	constexpr std::size_t SlotCount = 64;
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Emitting a signal with " + std::to_string(SlotCount) + " slots of different kinds");
+	bench.unit("slot");
+	bench.batch(SlotCount);
+	bench.minEpochIterations(1000);
+
+	std::vector<Listener> listeners(SlotCount);
+
+	{
+		Nz::Signal<int> signal;
+		for (Listener& listener : listeners)
+			signal.Connect([&listener](int value) { listener.total += value; });
+
+		bench.run("lambda (inline callback)", [&]
+		{
+			signal(1);
+			ankerl::nanobench::doNotOptimizeAway(listeners.data());
+		});
+	}
+
+	{
+		Nz::Signal<int> signal;
+		for (Listener& listener : listeners)
+			signal.Connect(listener, &Listener::OnEvent);
+
+		bench.run("member function", [&]
+		{
+			signal(1);
+			ankerl::nanobench::doNotOptimizeAway(listeners.data());
+		});
+	}
+
+	{
+		// Captures bigger than the callback inline storage are moved to the heap
+		std::array<int, 16> bigCapture = {};
+		bigCapture[0] = 1;
+
+		Nz::Signal<int> signal;
+		for (Listener& listener : listeners)
+			signal.Connect([&listener, bigCapture](int value) { listener.total += value * bigCapture[0]; });
+
+		bench.run("lambda (heap-allocated callback)", [&]
+		{
+			signal(1);
+			ankerl::nanobench::doNotOptimizeAway(listeners.data());
+		});
+	}
+
+	{
+		Nz::ConcurrentSignal<int> signal;
+		for (Listener& listener : listeners)
+			signal.Connect([&listener](int value) { listener.total += value; });
+
+		bench.run("Nz::ConcurrentSignal lambda", [&]
+		{
+			signal(1);
+			ankerl::nanobench::doNotOptimizeAway(listeners.data());
+		});
+	}
+
+	{
+		Nz::QueuedSignal<int> signal;
+		for (Listener& listener : listeners)
+			signal.Connect([&listener](int value) { listener.total += value; });
+
+		bench.run("Nz::QueuedSignal lambda (emit + flush)", [&]
+		{
+			signal(1);
+			signal.Flush();
+			ankerl::nanobench::doNotOptimizeAway(listeners.data());
+		});
+	}
+
+	std::ofstream output("bench-Signal-slot-kinds.json");
+	ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, output);
+}
+
+void BenchConnections()
+{
+	constexpr std::size_t SlotCount = 64;
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Connecting and disconnecting with " + std::to_string(SlotCount) + " other slots");
+	bench.minEpochIterations(1000);
+
+	Nz::Signal<int> signal;
+
+	int total = 0;
+	for (std::size_t i = 0; i < SlotCount; ++i)
+		signal.Connect([&total](int value) { total += value; });
+
+	bench.run("ConnectionGuard churn", [&]
+	{
+		Nz::Signal<int>::ConnectionGuard guard = signal.Connect([&total](int value) { total += value; });
+		ankerl::nanobench::doNotOptimizeAway(guard);
+	});
+
+	bench.run("connect, emit and disconnect", [&]
+	{
+		Nz::Signal<int>::Connection connection = signal.Connect([&total](int value) { total += value; });
+		signal(1);
+		connection.Disconnect();
+		ankerl::nanobench::doNotOptimizeAway(total);
+	});
+
+	bench.run("connect, emit and disconnect inside the callback", [&]
+	{
+		Nz::Signal<int>::Connection connection;
+		connection = signal.Connect([&](int value)
+		{
+			total += value;
+			connection.Disconnect();
+		});
+		signal(1);
+		ankerl::nanobench::doNotOptimizeAway(total);
+	});
+
+	Nz::ConcurrentSignal<int> concurrentSignal;
+	for (std::size_t i = 0; i < SlotCount; ++i)
+		concurrentSignal.Connect([&total](int value) { total += value; });
+
+	bench.run("Nz::ConcurrentSignal ConnectionGuard churn", [&]
+	{
+		Nz::ConcurrentSignal<int>::ConnectionGuard guard = concurrentSignal.Connect([&total](int value) { total += value; });
+		ankerl::nanobench::doNotOptimizeAway(guard);
+	});
+
+	std::ofstream output("bench-Signal-connections.json");
+	ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, output);
+}
+
+int main()
+{
+	// Results are also exported as JSON (one file per bench), to compare them between runs
+	BenchEmit();
+	BenchSlotKinds();
+	BenchConnections();
+}
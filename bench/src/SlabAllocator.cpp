@@ -0,0 +1,57 @@
+#include <NazaraUtils/SlabAllocator.hpp>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+template<typename Alloc, typename Free>
+void RunChurn(ankerl::nanobench::Bench& bench, const char* name, const std::vector<std::size_t>& sizes, Alloc&& allocate, Free&& free)
+{
+	std::vector<void*> allocations(sizes.size(), nullptr);
+
+	std::size_t index = 0;
+	bench.run(name, [&] {
+		// Keep a sliding window of live allocations, freeing the oldest one before replacing it
+		if (allocations[index])
+			free(allocations[index], sizes[index]);
+
+		allocations[index] = allocate(sizes[index]);
+		ankerl::nanobench::doNotOptimizeAway(allocations[index]);
+
+		if (++index == allocations.size())
+			index = 0;
+	});
+
+	for (std::size_t i = 0; i < allocations.size(); ++i)
+	{
+		if (allocations[i])
+			free(allocations[i], sizes[i]);
+	}
+}
+
+void TestSlabAllocator(std::size_t liveAllocationCount, std::size_t maxSize)
+{
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100'000);
+	bench.title("Small object churn (" + std::to_string(liveAllocationCount) + " live allocations of 1-" + std::to_string(maxSize) + " bytes)");
+
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<std::size_t> dis(1, maxSize);
+
+	std::vector<std::size_t> sizes(liveAllocationCount);
+	for (std::size_t& size : sizes)
+		size = dis(gen);
+
+	RunChurn(bench, "malloc/free", sizes, [](std::size_t size) { return std::malloc(size); }, [](void* ptr, std::size_t /*size*/) { std::free(ptr); });
+
+	Nz::SlabAllocator allocator;
+	RunChurn(bench, "SlabAllocator", sizes, [&](std::size_t size) { return allocator.Allocate(size); }, [&](void* ptr, std::size_t size) { allocator.Free(ptr, size); });
+}
+
+int main()
+{
+	TestSlabAllocator(1'000, 64);
+	TestSlabAllocator(100'000, 64);
+	TestSlabAllocator(100'000, 1024);
+}
@@ -0,0 +1,153 @@
+#include <NazaraUtils/TLSFAllocator.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+namespace
+{
+	struct LatencyReport
+	{
+		std::vector<std::chrono::nanoseconds::rep> samples;
+
+		void Print(const char* name)
+		{
+			std::sort(samples.begin(), samples.end());
+
+			auto Percentile = [&](double percentile)
+			{
+				return samples[std::min(samples.size() - 1, static_cast<std::size_t>(percentile * samples.size()))];
+			};
+
+			std::printf("| %-20s | %8lld | %8lld | %8lld | %10lld |\n", name, static_cast<long long>(Percentile(0.5)), static_cast<long long>(Percentile(0.99)), static_cast<long long>(Percentile(0.9999)), static_cast<long long>(samples.back()));
+		}
+	};
+
+	// Replays the same random sequence of allocations, frees and reallocations while timing every operation
+	template<typename Alloc, typename Free, typename Realloc>
+	LatencyReport Stress(std::size_t operationCount, std::size_t liveAllocationCount, std::size_t maxSize, Alloc&& allocate, Free&& free, Realloc&& reallocate)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		LatencyReport report;
+		report.samples.reserve(operationCount);
+
+		std::minstd_rand gen(42);
+		std::uniform_int_distribution<std::size_t> sizeDis(1, maxSize);
+		std::uniform_int_distribution<std::size_t> indexDis(0, liveAllocationCount - 1);
+		std::uniform_int_distribution<int> opDis(0, 3);
+
+		std::vector<void*> allocations(liveAllocationCount, nullptr);
+		for (std::size_t i = 0; i < operationCount; ++i)
+		{
+			std::size_t index = indexDis(gen);
+			std::size_t size = sizeDis(gen);
+			int op = opDis(gen);
+
+			void*& ptr = allocations[index];
+
+			auto start = Clock::now();
+			if (!ptr)
+				ptr = allocate(size);
+			else if (op == 0)
+				ptr = reallocate(ptr, size);
+			else
+			{
+				free(ptr);
+				ptr = nullptr;
+			}
+			auto end = Clock::now();
+
+			ankerl::nanobench::doNotOptimizeAway(ptr);
+			report.samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+		}
+
+		for (void* ptr : allocations)
+			free(ptr);
+
+		return report;
+	}
+}
+
+void TestTLSFAllocator(std::size_t liveAllocationCount, std::size_t maxSize)
+{
+	constexpr std::size_t RegionSize = 256 * 1024 * 1024;
+	constexpr std::size_t OperationCount = 2'000'000;
+
+	std::unique_ptr<std::byte[]> region(new std::byte[RegionSize]);
+	std::memset(region.get(), 0, RegionSize); //< prefault pages as a real-time application would, so that first touches don't show up as worst-case latency
+
+	std::printf("\nStress test: %zu operations, %zu live allocations of 1-%zu bytes (latency in ns)\n\n", OperationCount, liveAllocationCount, maxSize);
+	std::printf("| %-20s | %8s | %8s | %8s | %10s |\n", "allocator", "median", "p99", "p99.99", "worst-case");
+	std::printf("|----------------------|----------|----------|----------|------------|\n");
+
+	Stress(OperationCount, liveAllocationCount, maxSize,
+		[](std::size_t size) { return std::malloc(size); },
+		[](void* ptr) { std::free(ptr); },
+		[](void* ptr, std::size_t size) { return std::realloc(ptr, size); }
+	).Print("malloc/free");
+
+	{
+		Nz::TLSFAllocator allocator(region.get(), RegionSize);
+		Stress(OperationCount, liveAllocationCount, maxSize,
+			[&](std::size_t size) { return allocator.Allocate(size); },
+			[&](void* ptr) { allocator.Free(ptr); },
+			[&](void* ptr, std::size_t size) { return allocator.Reallocate(ptr, size); }
+		).Print("TLSFAllocator");
+	}
+
+	ankerl::nanobench::Bench bench;
+	bench.minEpochIterations(100'000);
+	bench.title("Allocate + Free pairs (" + std::to_string(liveAllocationCount) + " live allocations of 1-" + std::to_string(maxSize) + " bytes)");
+
+	std::minstd_rand gen(42);
+	std::uniform_int_distribution<std::size_t> sizeDis(1, maxSize);
+
+	std::vector<std::size_t> sizes(liveAllocationCount);
+	for (std::size_t& size : sizes)
+		size = sizeDis(gen);
+
+	{
+		std::vector<void*> allocations(liveAllocationCount, nullptr);
+		std::size_t index = 0;
+		bench.run("malloc/free", [&] {
+			std::free(allocations[index]);
+			allocations[index] = std::malloc(sizes[index]);
+			ankerl::nanobench::doNotOptimizeAway(allocations[index]);
+
+			if (++index == allocations.size())
+				index = 0;
+		});
+
+		for (void* ptr : allocations)
+			std::free(ptr);
+	}
+
+	{
+		Nz::TLSFAllocator allocator(region.get(), RegionSize);
+
+		std::vector<void*> allocations(liveAllocationCount, nullptr);
+		std::size_t index = 0;
+		bench.run("TLSFAllocator", [&] {
+			allocator.Free(allocations[index]);
+			allocations[index] = allocator.Allocate(sizes[index]);
+			ankerl::nanobench::doNotOptimizeAway(allocations[index]);
+
+			if (++index == allocations.size())
+				index = 0;
+		});
+	}
+}
+
+int main()
+{
+	TestTLSFAllocator(1'000, 256);
+	TestTLSFAllocator(100'000, 256);
+	TestTLSFAllocator(10'000, 64 * 1024);
+}
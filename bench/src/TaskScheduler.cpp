@@ -0,0 +1,71 @@
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+#include <nanobench.h>
+
+constexpr std::size_t TaskCount = 10'000;
+
+std::size_t Fibonacci(Nz::TaskScheduler& scheduler, std::size_t n)
+{
+	if (n < 16)
+		return (n < 2) ? n : Fibonacci(scheduler, n - 1) + Fibonacci(scheduler, n - 2);
+
+	std::size_t a, b;
+
+	Nz::TaskScheduler::Counter counter;
+	scheduler.AddTask([&] { a = Fibonacci(scheduler, n - 1); }, &counter);
+	b = Fibonacci(scheduler, n - 2);
+	scheduler.WaitFor(counter);
+
+	return a + b;
+}
+
+int main()
+{
+	Nz::TaskScheduler scheduler;
+
+	ankerl::nanobench::Bench bench;
+	bench.title("Running " + std::to_string(TaskCount) + " small tasks on " + std::to_string(scheduler.GetWorkerCount()) + " workers");
+	bench.unit("task");
+	bench.batch(TaskCount);
+	bench.minEpochIterations(10);
+
+	bench.run("std::async", [&]
+	{
+		std::atomic<std::size_t> sum(0);
+
+		std::vector<std::future<void>> futures;
+		futures.reserve(TaskCount);
+		for (std::size_t i = 0; i < TaskCount; ++i)
+			futures.push_back(std::async(std::launch::async, [&sum, i] { sum += i; }));
+
+		for (auto& future : futures)
+			future.wait();
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("Nz::TaskScheduler", [&]
+	{
+		std::atomic<std::size_t> sum(0);
+
+		Nz::TaskScheduler::Counter counter;
+		for (std::size_t i = 0; i < TaskCount; ++i)
+			scheduler.AddTask([&sum, i] { sum += i; }, &counter);
+
+		scheduler.WaitFor(counter);
+
+		ankerl::nanobench::doNotOptimizeAway(sum);
+	});
+
+	ankerl::nanobench::Bench recursiveBench;
+	recursiveBench.title("Recursive task spawning");
+	recursiveBench.minEpochIterations(10);
+
+	recursiveBench.run("Fibonacci(30)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Fibonacci(scheduler, 30));
+	});
+}
@@ -44,6 +44,9 @@ if has_config("bench") then
             add_deps("NazaraUtils")
             add_defines("ANKERL_NANOBENCH_IMPLEMENT")
             add_packages("nanobench")
+            if is_plat("linux", "bsd") then
+                add_syslinks("pthread")
+            end
         end)
     end
 end
@@ -43,6 +43,8 @@ namespace Nz
 	template<std::size_t N> [[nodiscard]] constexpr std::size_t CountOf(const char(&str)[N]) noexcept;
 	template<typename P, typename T> [[nodiscard]] NAZARA_CONSTEXPR_BITCAST P IntegerToPointer(T ptrAsInt) noexcept;
 	template<typename T, typename P> [[nodiscard]] NAZARA_CONSTEXPR_BITCAST T PointerToInteger(P* ptr) noexcept;
+	template<typename T> void RadixSort(T* data, std::size_t count, T* buffer);
+	template<typename T, typename F> void RadixSort(T* data, std::size_t count, T* buffer, F&& keyExtractor);
 	template<typename M, typename T> [[nodiscard]] NAZARA_CONSTEXPR20 auto& Retrieve(M& map, const T& key) noexcept;
 	template<typename M, typename T> [[nodiscard]] NAZARA_CONSTEXPR20 const auto& Retrieve(const M& map, const T& key) noexcept;
 	template<typename To, typename From> [[nodiscard]] NAZARA_CONSTEXPR20 To SafeCast(From&& value) noexcept;
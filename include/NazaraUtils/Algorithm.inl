@@ -4,7 +4,11 @@
 
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/Assert.hpp>
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <functional>
+#include <utility>
 
 #ifdef NAZARA_HAS_CONSTEXPR_BITCAST_STD
 #include <bit>
@@ -55,6 +59,45 @@ namespace Nz
 			private:
 				From m_from;
 		};
+
+		struct RadixIdentity
+		{
+			template<typename T>
+			constexpr const T& operator()(const T& value) const noexcept
+			{
+				return value;
+			}
+		};
+
+		// Maps a key to an unsigned integer of the same size whose order matches the key order
+		template<typename K>
+		constexpr auto ToRadixKey(K key) noexcept
+		{
+			if constexpr (std::is_enum_v<K>)
+				return ToRadixKey(static_cast<std::underlying_type_t<K>>(key));
+			else if constexpr (std::is_same_v<K, bool>)
+				return static_cast<UInt8>(key);
+			else if constexpr (std::is_floating_point_v<K>)
+			{
+				static_assert(sizeof(K) == sizeof(UInt32) || sizeof(K) == sizeof(UInt64), "unsupported floating-point type");
+				using U = std::conditional_t<sizeof(K) == sizeof(UInt32), UInt32, UInt64>;
+
+				// Negative values have all their bits flipped (reversing their order), positive values only their sign bit
+				constexpr U SignBit = U(1) << (sizeof(U) * 8 - 1);
+				U bits = BitCast<U>(key);
+				return (bits & SignBit) ? static_cast<U>(~bits) : static_cast<U>(bits | SignBit);
+			}
+			else if constexpr (std::is_signed_v<K>)
+			{
+				using U = std::make_unsigned_t<K>;
+				return static_cast<U>(static_cast<U>(key) ^ (U(1) << (sizeof(U) * 8 - 1)));
+			}
+			else
+			{
+				static_assert(std::is_unsigned_v<K>, "radix sort keys must be integers, floating-points or enums");
+				return key;
+			}
+		}
 	}
 
 
@@ -159,6 +202,115 @@ namespace Nz
 		return SafeCast<T>(BitCast<std::uintptr_t>(ptr));
 	}
 
+	/*!
+	* \ingroup utils
+	* \brief Sorts an array of integers, floating-points or enums with a stable LSD radix sort
+	*
+	* \param data Pointer to the elements to sort
+	* \param count Number of elements
+	* \param buffer Pointer to a buffer of count elements used as scratch memory (for example from a StackArray or a LinearArena)
+	*
+	* \see RadixSort
+	*/
+	template<typename T>
+	void RadixSort(T* data, std::size_t count, T* buffer)
+	{
+		RadixSort(data, count, buffer, Detail::RadixIdentity{});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Sorts an array by a key with a stable LSD radix sort
+	*
+	* Elements are distributed eight bits of key at a time between data and buffer, the histograms of every digit being computed by a single pass over the data.
+	* Passes for which every key has the same digit are skipped (which is common for small values in large integer types).
+	* Signed integers and floating-points are sorted by their value (negative floating-points sort before -0.0, which sorts before +0.0, NaNs are put at both ends depending on their sign).
+	*
+	* \param data Pointer to the elements to sort
+	* \param count Number of elements
+	* \param buffer Pointer to a buffer of count elements used as scratch memory (for example from a StackArray or a LinearArena), elements are moved into it
+	* \param keyExtractor Function returning the key of an element (an integer, floating-point or enum), called multiple times per element
+	*/
+	template<typename T, typename F>
+	void RadixSort(T* data, std::size_t count, T* buffer, F&& keyExtractor)
+	{
+		constexpr std::size_t InsertionSortThreshold = 32;
+
+		auto GetKey = [&](const T& value)
+		{
+			return Detail::ToRadixKey(std::invoke(keyExtractor, value));
+		};
+
+		using Key = decltype(GetKey(*data));
+		constexpr std::size_t PassCount = sizeof(Key);
+
+		if (count < 2)
+			return;
+
+		if (count <= InsertionSortThreshold)
+		{
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				Key key = GetKey(data[i]);
+				if (GetKey(data[i - 1]) <= key)
+					continue;
+
+				T value = std::move(data[i]);
+				std::size_t j = i;
+				do
+				{
+					data[j] = std::move(data[j - 1]);
+					--j;
+				}
+				while (j > 0 && GetKey(data[j - 1]) > key);
+
+				data[j] = std::move(value);
+			}
+
+			return;
+		}
+
+		NazaraAssert(buffer);
+
+		std::array<std::array<std::size_t, 256>, PassCount> histograms = {};
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Key key = GetKey(data[i]);
+			for (std::size_t pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+		}
+
+		T* source = data;
+		T* destination = buffer;
+		for (std::size_t pass = 0; pass < PassCount; ++pass)
+		{
+			std::size_t shift = pass * 8;
+
+			auto& histogram = histograms[pass];
+			if (histogram[(GetKey(source[0]) >> shift) & 0xFF] == count)
+				continue; //< every key has the same digit
+
+			std::size_t offset = 0;
+			for (std::size_t& digitCount : histogram)
+			{
+				std::size_t digitOffset = offset;
+				offset += digitCount;
+				digitCount = digitOffset;
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				std::size_t digit = (GetKey(source[i]) >> shift) & 0xFF;
+				destination[histogram[digit]++] = std::move(source[i]);
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != data)
+			std::move(source, source + count, data);
+	}
+
 	/*!
 	* \ingroup utils
 	* \brief Helper function to retrieve a key in a map which has to exist
@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_CONCURRENTSIGNAL_HPP
+#define NAZARAUTILS_CONCURRENTSIGNAL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#define NazaraConcurrentSignal(SignalName, ...) using SignalName ## Type = Nz::ConcurrentSignal<__VA_ARGS__>; \
+                                                mutable SignalName ## Type SignalName
+
+namespace Nz
+{
+	template<typename... Args>
+	class ConcurrentSignal
+	{
+		public:
+			using Callback = InplaceFunction<void(Args...)>;
+			class Connection;
+			class ConnectionGuard;
+
+			ConcurrentSignal();
+			ConcurrentSignal(const ConcurrentSignal&);
+			ConcurrentSignal(ConcurrentSignal&& signal) noexcept;
+			~ConcurrentSignal();
+
+			void Clear();
+
+			template<typename F, typename = std::enable_if_t<std::is_invocable_v<std::decay_t<F>&, Args...>>> Connection Connect(F&& func);
+			template<typename O> Connection Connect(O& object, void (O::*method)(Args...));
+			template<typename O> Connection Connect(O* object, void (O::*method)(Args...));
+			template<typename O> Connection Connect(const O& object, void (O::*method)(Args...) const);
+			template<typename O> Connection Connect(const O* object, void (O::*method)(Args...) const);
+
+			void operator()(Args... args) const;
+
+			ConcurrentSignal& operator=(const ConcurrentSignal&);
+			ConcurrentSignal& operator=(ConcurrentSignal&& signal) noexcept;
+
+		private:
+			struct Slot
+			{
+				Slot(Callback&& func);
+
+				Callback callback;
+				std::atomic_bool connected;
+			};
+
+			using SlotList = std::vector<std::shared_ptr<Slot>>;
+
+			struct State
+			{
+				State();
+				~State();
+
+				void Disconnect(const std::shared_ptr<Slot>& slot);
+				void Publish(SlotList* slotList, std::unique_lock<std::mutex>& lock);
+				void Reclaim(std::unique_lock<std::mutex>& lock);
+
+				std::atomic<SlotList*> slots;
+				std::atomic<UInt32> emitterCount;
+				std::atomic_bool hasRetiredLists;
+				std::mutex mutex;
+				std::vector<SlotList*> retiredLists;
+			};
+
+			std::shared_ptr<State> m_state;
+	};
+
+	template<typename... Args>
+	class ConcurrentSignal<Args...>::Connection
+	{
+		using BaseClass = ConcurrentSignal<Args...>;
+		friend BaseClass;
+
+		public:
+			Connection() = default;
+			Connection(const Connection& connection) = default;
+			Connection(Connection&& connection) noexcept = default;
+			~Connection() = default;
+
+			template<typename... ConnectArgs>
+			void Connect(BaseClass& signal, ConnectArgs&&... args);
+			void Disconnect() noexcept;
+
+			bool IsConnected() const;
+
+			Connection& operator=(const Connection& connection) = default;
+			Connection& operator=(Connection&& connection) noexcept = default;
+
+		private:
+			Connection(const std::shared_ptr<State>& state, const std::shared_ptr<Slot>& slot);
+
+			std::weak_ptr<State> m_state;
+			std::weak_ptr<Slot> m_slot;
+	};
+
+	template<typename... Args>
+	class ConcurrentSignal<Args...>::ConnectionGuard
+	{
+		using BaseClass = ConcurrentSignal<Args...>;
+		using Connection = typename BaseClass::Connection;
+
+		public:
+			ConnectionGuard() = default;
+			ConnectionGuard(const Connection& connection);
+			ConnectionGuard(const ConnectionGuard& connection) = delete;
+			ConnectionGuard(Connection&& connection);
+			ConnectionGuard(ConnectionGuard&& connection) noexcept = default;
+			~ConnectionGuard();
+
+			template<typename... ConnectArgs>
+			void Connect(BaseClass& signal, ConnectArgs&&... args);
+			void Disconnect() noexcept;
+
+			Connection& GetConnection();
+
+			bool IsConnected() const;
+
+			ConnectionGuard& operator=(const Connection& connection);
+			ConnectionGuard& operator=(const ConnectionGuard& connection) = delete;
+			ConnectionGuard& operator=(Connection&& connection);
+			ConnectionGuard& operator=(ConnectionGuard&& connection) noexcept;
+
+		private:
+			Connection m_connection;
+	};
+}
+
+#include <NazaraUtils/ConcurrentSignal.inl>
+
+#endif // NAZARAUTILS_CONCURRENTSIGNAL_HPP
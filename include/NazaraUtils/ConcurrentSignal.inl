@@ -0,0 +1,554 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ConcurrentSignal
+	* \brief Thread-safe signal, which can be emitted, connected to and disconnected from any thread
+	*
+	* Emitting doesn't lock: it iterates over an immutable snapshot of the slot list.
+	* Connecting and disconnecting copy the list under a mutex and publish the new list,
+	* the old one being destroyed once no emission is running anymore.
+	*
+	* A slot disconnected while being emitted by another thread may still be called by this emission, but its callback is never destroyed while running.
+	* Slots connected while emitting are called starting with the next emission.
+	* Callbacks can be called by multiple threads at the same time and must be thread-safe.
+	*
+	* \remark Moving or assigning a signal is not thread-safe
+	* \see Signal
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal object by default
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConcurrentSignal() :
+	m_state(std::make_shared<State>())
+	{
+	}
+
+	/*!
+	* \brief Constructs a ConcurrentSignal object by default
+	*
+	* \remark It doesn't make sense to copy a signal, this is only available for convenience to allow compiler-generated copy constructors
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConcurrentSignal(const ConcurrentSignal&) :
+	ConcurrentSignal()
+	{
+	}
+
+	/*!
+	* \brief Constructs a ConcurrentSignal object by move semantic
+	*
+	* \param signal Signal to move in this
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConcurrentSignal(ConcurrentSignal&& signal) noexcept :
+	m_state(std::move(signal.m_state))
+	{
+	}
+
+	/*!
+	* \brief Destructs the signal and disconnects its slots
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::~ConcurrentSignal()
+	{
+		if (m_state)
+			Clear();
+	}
+
+	/*!
+	* \brief Disconnects every slot of the signal
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::Clear()
+	{
+		if (!m_state)
+			return;
+
+		std::unique_lock<std::mutex> lock(m_state->mutex);
+		if (SlotList* slotList = m_state->slots.load(std::memory_order_relaxed))
+		{
+			for (const std::shared_ptr<Slot>& slot : *slotList)
+				slot->connected.store(false, std::memory_order_release);
+		}
+
+		m_state->Publish(nullptr, lock);
+	}
+
+	/*!
+	* \brief Connects a function to the signal
+	* \return Connection attached to the signal
+	*
+	* \param func Function object (non-member function, lambda, Callback, ...)
+	*/
+	template<typename... Args>
+	template<typename F, typename>
+	typename ConcurrentSignal<Args...>::Connection ConcurrentSignal<Args...>::Connect(F&& func)
+	{
+		using Functor = std::decay_t<F>;
+
+		if constexpr (std::is_same_v<Functor, Callback> || std::is_pointer_v<std::remove_reference_t<F>>)
+		{
+			NazaraAssertMsg(func, "invalid function");
+		}
+
+		if (!m_state)
+			m_state = std::make_shared<State>(); //< moved-from signal
+
+		std::shared_ptr<Slot> slot;
+
+		constexpr bool IsStoredInline = std::is_same_v<Functor, Callback> || (sizeof(Functor) <= Callback::StorageCapacity && alignof(Functor) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Functor>);
+		if constexpr (IsStoredInline)
+			slot = std::make_shared<Slot>(Callback(std::forward<F>(func)));
+		else
+		{
+			// Callable is too big (or not nothrow movable) to be stored inline
+			slot = std::make_shared<Slot>(Callback([functor = std::make_unique<Functor>(std::forward<F>(func))](Args... args) { (*functor)(std::forward<Args>(args)...); }));
+		}
+
+		std::unique_lock<std::mutex> lock(m_state->mutex);
+
+		SlotList* slotList = m_state->slots.load(std::memory_order_relaxed);
+		SlotList* newSlotList = (slotList) ? new SlotList(*slotList) : new SlotList;
+		newSlotList->push_back(slot);
+
+		m_state->Publish(newSlotList, lock);
+
+		return Connection(m_state, slot);
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename ConcurrentSignal<Args...>::Connection ConcurrentSignal<Args...>::Connect(O& object, void (O::*method) (Args...))
+	{
+		return Connect([&object, method] (Args&&... args)
+		{
+			return (object .* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename ConcurrentSignal<Args...>::Connection ConcurrentSignal<Args...>::Connect(O* object, void (O::*method)(Args...))
+	{
+		return Connect([object, method] (Args&&... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename ConcurrentSignal<Args...>::Connection ConcurrentSignal<Args...>::Connect(const O& object, void (O::*method) (Args...) const)
+	{
+		return Connect([&object, method] (Args&&... args)
+		{
+			return (object .* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Connects a member function and its object to the signal
+	* \return Connection attached to the signal
+	*
+	* \param object Object to send the message
+	* \param method Member function
+	*/
+
+	template<typename... Args>
+	template<typename O>
+	typename ConcurrentSignal<Args...>::Connection ConcurrentSignal<Args...>::Connect(const O* object, void (O::*method)(Args...) const)
+	{
+		return Connect([object, method] (Args&&... args)
+		{
+			return (object ->* method) (std::forward<Args>(args)...);
+		});
+	}
+
+	/*!
+	* \brief Applies the list of arguments to every callback functions
+	*
+	* \param args Arguments to send with the message
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::operator()(Args... args) const
+	{
+		if (!m_state)
+			return;
+
+		State& state = *m_state;
+
+		// Registering this emission prevents the slot list we're about to read from being destroyed
+		state.emitterCount.fetch_add(1);
+		NAZARA_DEFER({
+			if (state.emitterCount.fetch_sub(1) == 1 && state.hasRetiredLists.load())
+			{
+				// We were the last emission, try to destroy old lists if no other thread is using the mutex
+				std::unique_lock<std::mutex> lock(state.mutex, std::try_to_lock);
+				if (lock.owns_lock())
+					state.Reclaim(lock);
+			}
+		});
+
+		if (SlotList* slotList = state.slots.load())
+		{
+			for (const std::shared_ptr<Slot>& slot : *slotList)
+			{
+				if (slot->connected.load(std::memory_order_acquire))
+					slot->callback(args...);
+			}
+		}
+	}
+
+	/*!
+	* \brief Doesn't do anything
+	* \return A reference to this
+	*
+	* \remark This is only for convenience to allow compiled-generated assignation operator
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>& ConcurrentSignal<Args...>::operator=(const ConcurrentSignal&)
+	{
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the signal into this
+	* \return A reference to this
+	*
+	* \param signal Signal to move in this
+	*
+	* \remark Slots of this signal are disconnected, connections of the moved signal stay valid
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>& ConcurrentSignal<Args...>::operator=(ConcurrentSignal&& signal) noexcept
+	{
+		if (this == &signal)
+			return *this;
+
+		Clear();
+		m_state = std::move(signal.m_state);
+
+		return *this;
+	}
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::Slot::Slot(Callback&& func) :
+	callback(std::move(func)),
+	connected(true)
+	{
+	}
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::State::State() :
+	slots(nullptr),
+	emitterCount(0),
+	hasRetiredLists(false)
+	{
+	}
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::State::~State()
+	{
+		NazaraAssertMsg(emitterCount.load(std::memory_order_relaxed) == 0, "signal destroyed while being emitted");
+
+		delete slots.load(std::memory_order_relaxed);
+		for (SlotList* slotList : retiredLists)
+			delete slotList;
+	}
+
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::Disconnect(const std::shared_ptr<Slot>& slot)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (!slot->connected.exchange(false, std::memory_order_acq_rel))
+			return; //< already disconnected
+
+		SlotList* slotList = slots.load(std::memory_order_relaxed);
+		NazaraAssert(slotList);
+
+		SlotList* newSlotList = nullptr;
+		if (slotList->size() > 1)
+		{
+			newSlotList = new SlotList;
+			newSlotList->reserve(slotList->size() - 1);
+			for (const std::shared_ptr<Slot>& otherSlot : *slotList)
+			{
+				if (otherSlot != slot)
+					newSlotList->push_back(otherSlot);
+			}
+		}
+
+		Publish(newSlotList, lock);
+	}
+
+	// Replaces the slot list (mutex must be locked), the old list is destroyed as soon as no emission may be using it
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::Publish(SlotList* slotList, std::unique_lock<std::mutex>& lock)
+	{
+		if (SlotList* oldSlotList = slots.exchange(slotList))
+		{
+			retiredLists.push_back(oldSlotList);
+			hasRetiredLists.store(true);
+		}
+
+		Reclaim(lock);
+	}
+
+	// Destroys retired lists if no emission is running (mutex must be locked, it is unlocked by this function)
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::State::Reclaim(std::unique_lock<std::mutex>& lock)
+	{
+		// An emission starting after this check will read the current list (emitterCount and slots accesses are sequentially consistent)
+		if (retiredLists.empty() || emitterCount.load() != 0)
+		{
+			lock.unlock();
+			return;
+		}
+
+		std::vector<SlotList*> oldSlotLists = std::move(retiredLists);
+		retiredLists.clear();
+		hasRetiredLists.store(false);
+
+		// Destroy lists (and disconnected callbacks) outside of the lock, callback destructors may use the signal
+		lock.unlock();
+		for (SlotList* slotList : oldSlotLists)
+			delete slotList;
+	}
+
+	/*!
+	* \class Nz::ConcurrentSignal::Connection
+	* \brief Represents a connection attached to a concurrent signal
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::Connection object referencing a slot
+	*
+	* \param state State of the signal
+	* \param slot Slot of the listener
+	*/
+	template<typename... Args>
+	ConcurrentSignal<Args...>::Connection::Connection(const std::shared_ptr<State>& state, const std::shared_ptr<Slot>& slot) :
+	m_state(state),
+	m_slot(slot)
+	{
+	}
+
+	/*!
+	* \brief Connects to a signal with arguments
+	*
+	* \param signal New signal to listen
+	* \param args Arguments for the signal
+	*/
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	void ConcurrentSignal<Args...>::Connection::Connect(BaseClass& signal, ConnectArgs&&... args)
+	{
+		operator=(signal.Connect(std::forward<ConnectArgs>(args)...));
+	}
+
+	/*!
+	* \brief Disconnects the connection from the signal
+	*
+	* \remark The callback may still be running (or about to run) in emissions started by other threads before this call
+	*/
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::Connection::Disconnect() noexcept
+	{
+		if (std::shared_ptr<State> state = m_state.lock())
+		{
+			if (std::shared_ptr<Slot> slot = m_slot.lock())
+				state->Disconnect(slot);
+		}
+
+		m_state.reset();
+		m_slot.reset();
+	}
+
+	/*!
+	* \brief Checks whether the connection is still active with the signal
+	* \return true if signal is still active
+	*/
+	template<typename... Args>
+	bool ConcurrentSignal<Args...>::Connection::IsConnected() const
+	{
+		std::shared_ptr<Slot> slot = m_slot.lock();
+		return slot && slot->connected.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \class Nz::ConcurrentSignal::ConnectionGuard
+	* \brief Core class that represents a RAII for a connection attached to a signal
+	*/
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::ConnectionGuard object with a connection
+	*
+	* \param connection Connection for the scope
+	*/
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::ConnectionGuard(const Connection& connection) :
+	m_connection(connection)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ConcurrentSignal::ConnectionGuard object with a connection by move semantic
+	*
+	* \param connection Connection for the scope
+	*/
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::ConnectionGuard(Connection&& connection) :
+	m_connection(std::move(connection))
+	{
+	}
+
+	/*!
+	* \brief Destructs the object and disconnects the connection
+	*/
+
+	template<typename... Args>
+	ConcurrentSignal<Args...>::ConnectionGuard::~ConnectionGuard()
+	{
+		m_connection.Disconnect();
+	}
+
+	/*!
+	* \brief Connects to a signal with arguments
+	*
+	* \param signal New signal to listen
+	* \param args Arguments for the signal
+	*/
+
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	void ConcurrentSignal<Args...>::ConnectionGuard::Connect(BaseClass& signal, ConnectArgs&&... args)
+	{
+		m_connection.Disconnect();
+		m_connection.Connect(signal, std::forward<ConnectArgs>(args)...);
+	}
+
+	/*!
+	* \brief Disconnects the connection from the signal
+	*/
+
+	template<typename... Args>
+	void ConcurrentSignal<Args...>::ConnectionGuard::Disconnect() noexcept
+	{
+		m_connection.Disconnect();
+	}
+
+	/*!
+	* \brief Gets the connection attached to the signal
+	* \return Connection of the signal
+	*/
+
+	template<typename... Args>
+	typename ConcurrentSignal<Args...>::Connection& ConcurrentSignal<Args...>::ConnectionGuard::GetConnection()
+	{
+		return m_connection;
+	}
+
+	/*!
+	* \brief Checks whether the connection is still active with the signal
+	* \return true if signal is still active
+	*/
+
+	template<typename... Args>
+	bool ConcurrentSignal<Args...>::ConnectionGuard::IsConnected() const
+	{
+		return m_connection.IsConnected();
+	}
+
+	/*!
+	* \brief Assigns the connection into this
+	* \return A reference to this
+	*
+	* \param connection Connection to assign into this
+	*/
+
+	template<typename... Args>
+	typename ConcurrentSignal<Args...>::ConnectionGuard& ConcurrentSignal<Args...>::ConnectionGuard::operator=(const Connection& connection)
+	{
+		m_connection.Disconnect();
+		m_connection = connection;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the Connection into this
+	* \return A reference to this
+	*
+	* \param connection Connection to move in this
+	*/
+
+	template<typename... Args>
+	typename ConcurrentSignal<Args...>::ConnectionGuard& ConcurrentSignal<Args...>::ConnectionGuard::operator=(Connection&& connection)
+	{
+		if (&connection != this)
+		{
+			m_connection.Disconnect();
+			m_connection = std::move(connection);
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the ConnectionGuard into this
+	* \return A reference to this
+	*
+	* \param connection ConnectionGuard to move in this
+	*/
+
+	template<typename... Args>
+	typename ConcurrentSignal<Args...>::ConnectionGuard& ConcurrentSignal<Args...>::ConnectionGuard::operator=(ConnectionGuard&& connection) noexcept
+	{
+		if (&connection != this)
+		{
+			m_connection.Disconnect();
+			m_connection = std::move(connection.m_connection);
+		}
+
+		return *this;
+	}
+}
+
@@ -0,0 +1,187 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FIXEDRINGBUFFER_HPP
+#define NAZARAUTILS_FIXEDRINGBUFFER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, bool Growable>
+		class FixedRingBufferBase;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable = false>
+	class FixedRingBuffer : public Detail::FixedRingBufferBase<T, Growable>
+	{
+		static_assert(Capacity > 0 && IsPow2(Capacity), "ring buffer capacity must be a power of two");
+		using Base = Detail::FixedRingBufferBase<T, Growable>;
+
+		public:
+			template<bool Const> class Iterator;
+
+			static constexpr std::size_t FixedCapacity = Capacity;
+			using value_type = T;
+			using const_iterator = Iterator<true>;
+			using const_pointer = const value_type*;
+			using const_reference = const value_type&;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+			using difference_type = std::ptrdiff_t;
+			using iterator = Iterator<false>;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+			using size_type = std::size_t;
+
+			template<typename U>
+			struct Segment
+			{
+				U* data;
+				size_type size;
+			};
+
+			FixedRingBuffer();
+			FixedRingBuffer(const FixedRingBuffer& ringBuffer);
+			FixedRingBuffer(FixedRingBuffer&& ringBuffer) noexcept;
+			~FixedRingBuffer();
+
+			reference back();
+			const_reference back() const;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			size_type capacity() const noexcept;
+
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			void clear() noexcept;
+
+			template<typename... Args> reference emplace_back(Args&&... args);
+			template<typename... Args> reference emplace_front(Args&&... args);
+
+			bool empty() const noexcept;
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			reference front();
+			const_reference front() const;
+
+			bool full() const noexcept;
+
+			std::array<Segment<T>, 2> GetSegments() noexcept;
+			std::array<Segment<const T>, 2> GetSegments() const noexcept;
+
+			size_type max_size() const noexcept;
+
+			void pop_back();
+			void pop_front();
+
+			reference push_back(const T& value);
+			reference push_back(T&& value);
+			reference push_front(const T& value);
+			reference push_front(T&& value);
+
+			reverse_iterator rbegin() noexcept;
+			const_reverse_iterator rbegin() const noexcept;
+
+			reverse_iterator rend() noexcept;
+			const_reverse_iterator rend() const noexcept;
+
+			void reserve(size_type count);
+
+			size_type size() const noexcept;
+
+			reference operator[](size_type index);
+			const_reference operator[](size_type index) const;
+
+			FixedRingBuffer& operator=(const FixedRingBuffer& ringBuffer);
+			FixedRingBuffer& operator=(FixedRingBuffer&& ringBuffer) noexcept;
+
+			template<bool Const>
+			class Iterator
+			{
+				friend FixedRingBuffer;
+				template<bool> friend class Iterator;
+
+				public:
+					using RingBufferType = std::conditional_t<Const, const FixedRingBuffer, FixedRingBuffer>;
+
+					using difference_type = std::ptrdiff_t;
+					using iterator_category = std::random_access_iterator_tag;
+					using pointer = std::conditional_t<Const, const T*, T*>;
+					using reference = std::conditional_t<Const, const T&, T&>;
+					using value_type = T;
+
+					Iterator() = default;
+					template<bool C = Const, typename = std::enable_if_t<C>> Iterator(const Iterator<false>& it);
+					Iterator(const Iterator&) = default;
+					~Iterator() = default;
+
+					Iterator& operator=(const Iterator&) = default;
+
+					reference operator*() const;
+					pointer operator->() const;
+					reference operator[](difference_type n) const;
+
+					Iterator& operator++();
+					Iterator operator++(int);
+					Iterator& operator--();
+					Iterator operator--(int);
+
+					Iterator& operator+=(difference_type n);
+					Iterator& operator-=(difference_type n);
+					Iterator operator+(difference_type n) const;
+					Iterator operator-(difference_type n) const;
+					difference_type operator-(const Iterator& it) const;
+
+					bool operator==(const Iterator& it) const;
+					bool operator!=(const Iterator& it) const;
+					bool operator<(const Iterator& it) const;
+					bool operator<=(const Iterator& it) const;
+					bool operator>(const Iterator& it) const;
+					bool operator>=(const Iterator& it) const;
+
+				private:
+					Iterator(RingBufferType* ringBuffer, size_type index);
+
+					RingBufferType* m_ringBuffer = nullptr;
+					size_type m_index = 0;
+			};
+
+		private:
+			T* GetBuffer() noexcept;
+			const T* GetBuffer() const noexcept;
+			T* GetElement(size_type index) noexcept;
+			const T* GetElement(size_type index) const noexcept;
+			void Grow(size_type capacity);
+
+			size_type m_head;
+			size_type m_mask;
+			size_type m_size;
+			alignas(T) std::array<std::byte, sizeof(T) * Capacity> m_data;
+	};
+
+	template<typename T, std::size_t Capacity>
+	using HybridDeque = FixedRingBuffer<T, Capacity, true>;
+}
+
+#include <NazaraUtils/FixedRingBuffer.inl>
+
+#endif // NAZARAUTILS_FIXEDRINGBUFFER_HPP
@@ -0,0 +1,602 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, bool Growable>
+		class FixedRingBufferBase
+		{
+			public:
+				static constexpr bool IsGrowable = true;
+
+			protected:
+				T* heapBuffer = nullptr;
+		};
+
+		template<typename T>
+		class FixedRingBufferBase<T, false>
+		{
+			public:
+				static constexpr bool IsGrowable = false;
+		};
+	}
+
+	/*!
+	* \ingroup utils
+	* \class FixedRingBuffer
+	* \brief Double-ended queue stored in a circular buffer with a compile-time power-of-two capacity (and thus no allocation required)
+	*
+	* Elements are indexed by masking their position, and can be accessed as two contiguous segments (see GetSegments) for bulk copies.
+	* When Growable is true (see HybridDeque), elements are moved to a heap-allocated circular buffer of twice the capacity once full.
+	*/
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	FixedRingBuffer<T, Capacity, Growable>::FixedRingBuffer() :
+	m_head(0),
+	m_mask(Capacity - 1),
+	m_size(0)
+	{
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	FixedRingBuffer<T, Capacity, Growable>::FixedRingBuffer(const FixedRingBuffer& ringBuffer) :
+	FixedRingBuffer()
+	{
+		reserve(ringBuffer.size());
+		for (const T& value : ringBuffer)
+			push_back(value);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	FixedRingBuffer<T, Capacity, Growable>::FixedRingBuffer(FixedRingBuffer&& ringBuffer) noexcept :
+	FixedRingBuffer()
+	{
+		operator=(std::move(ringBuffer));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	FixedRingBuffer<T, Capacity, Growable>::~FixedRingBuffer()
+	{
+		clear();
+
+		if constexpr (Growable)
+		{
+			if (Base::heapBuffer)
+				std::allocator<T>{}.deallocate(Base::heapBuffer, m_mask + 1);
+		}
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::back() -> reference
+	{
+		NazaraAssert(!empty());
+		return *GetElement(m_size - 1);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::back() const -> const_reference
+	{
+		NazaraAssert(!empty());
+		return *GetElement(m_size - 1);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::begin() noexcept -> iterator
+	{
+		return iterator(this, 0);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::begin() const noexcept -> const_iterator
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::capacity() const noexcept -> size_type
+	{
+		return m_mask + 1;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::cbegin() const noexcept -> const_iterator
+	{
+		return const_iterator(this, 0);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::cend() const noexcept -> const_iterator
+	{
+		return const_iterator(this, m_size);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	void FixedRingBuffer<T, Capacity, Growable>::clear() noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_type i = 0; i < m_size; ++i)
+				PlacementDestroy(GetElement(i));
+		}
+
+		m_head = 0;
+		m_size = 0;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<typename... Args>
+	auto FixedRingBuffer<T, Capacity, Growable>::emplace_back(Args&&... args) -> reference
+	{
+		if constexpr (Growable)
+		{
+			if (full())
+			{
+				// Arguments may reference an element of this buffer, build the new element before moving them
+				T value(std::forward<Args>(args)...);
+				Grow(capacity() * 2);
+
+				return *PlacementNew(GetElement(m_size++), std::move(value));
+			}
+		}
+
+		NazaraAssertMsg(!full(), "ring buffer is full");
+		return *PlacementNew(GetElement(m_size++), std::forward<Args>(args)...);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<typename... Args>
+	auto FixedRingBuffer<T, Capacity, Growable>::emplace_front(Args&&... args) -> reference
+	{
+		if constexpr (Growable)
+		{
+			if (full())
+			{
+				// Arguments may reference an element of this buffer, build the new element before moving them
+				T value(std::forward<Args>(args)...);
+				Grow(capacity() * 2);
+
+				m_head = (m_head - 1) & m_mask;
+				m_size++;
+				return *PlacementNew(GetBuffer() + m_head, std::move(value));
+			}
+		}
+
+		NazaraAssertMsg(!full(), "ring buffer is full");
+		m_head = (m_head - 1) & m_mask;
+		m_size++;
+		return *PlacementNew(GetBuffer() + m_head, std::forward<Args>(args)...);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	bool FixedRingBuffer<T, Capacity, Growable>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::end() noexcept -> iterator
+	{
+		return iterator(this, m_size);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::end() const noexcept -> const_iterator
+	{
+		return const_iterator(this, m_size);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::front() -> reference
+	{
+		NazaraAssert(!empty());
+		return *GetElement(0);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::front() const -> const_reference
+	{
+		NazaraAssert(!empty());
+		return *GetElement(0);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	bool FixedRingBuffer<T, Capacity, Growable>::full() const noexcept
+	{
+		return m_size == capacity();
+	}
+
+	/*!
+	* \brief Returns the elements as two contiguous segments
+	*
+	* The first segment starts at the front element, the second one (which may be empty) holds the elements which wrapped around the end of the buffer.
+	*/
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::GetSegments() noexcept -> std::array<Segment<T>, 2>
+	{
+		size_type firstSize = std::min(m_size, capacity() - m_head);
+		return { Segment<T>{ GetBuffer() + m_head, firstSize }, Segment<T>{ GetBuffer(), m_size - firstSize } };
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::GetSegments() const noexcept -> std::array<Segment<const T>, 2>
+	{
+		size_type firstSize = std::min(m_size, capacity() - m_head);
+		return { Segment<const T>{ GetBuffer() + m_head, firstSize }, Segment<const T>{ GetBuffer(), m_size - firstSize } };
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::max_size() const noexcept -> size_type
+	{
+		if constexpr (Growable)
+			return std::allocator_traits<std::allocator<T>>::max_size(std::allocator<T>{});
+		else
+			return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	void FixedRingBuffer<T, Capacity, Growable>::pop_back()
+	{
+		NazaraAssert(!empty());
+		PlacementDestroy(GetElement(--m_size));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	void FixedRingBuffer<T, Capacity, Growable>::pop_front()
+	{
+		NazaraAssert(!empty());
+		PlacementDestroy(GetElement(0));
+		m_head = (m_head + 1) & m_mask;
+		m_size--;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::push_back(const T& value) -> reference
+	{
+		return emplace_back(value);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::push_back(T&& value) -> reference
+	{
+		return emplace_back(std::move(value));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::push_front(const T& value) -> reference
+	{
+		return emplace_front(value);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::push_front(T&& value) -> reference
+	{
+		return emplace_front(std::move(value));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::rbegin() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::rbegin() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::rend() noexcept -> reverse_iterator
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::rend() const noexcept -> const_reverse_iterator
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	void FixedRingBuffer<T, Capacity, Growable>::reserve(size_type count)
+	{
+		if constexpr (Growable)
+		{
+			if (count > capacity())
+				Grow(RoundToPow2(count));
+		}
+		else
+		{
+			NazaraAssert(count <= Capacity);
+		}
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::size() const noexcept -> size_type
+	{
+		return m_size;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::operator[](size_type index) -> reference
+	{
+		NazaraAssert(index < m_size);
+		return *GetElement(index);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::operator[](size_type index) const -> const_reference
+	{
+		NazaraAssert(index < m_size);
+		return *GetElement(index);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::operator=(const FixedRingBuffer& ringBuffer) -> FixedRingBuffer&
+	{
+		if (this == &ringBuffer)
+			return *this;
+
+		clear();
+		reserve(ringBuffer.size());
+		for (const T& value : ringBuffer)
+			push_back(value);
+
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	auto FixedRingBuffer<T, Capacity, Growable>::operator=(FixedRingBuffer&& ringBuffer) noexcept -> FixedRingBuffer&
+	{
+		if (this == &ringBuffer)
+			return *this;
+
+		clear();
+
+		if constexpr (Growable)
+		{
+			if (ringBuffer.heapBuffer)
+			{
+				// Steal the heap buffer
+				if (Base::heapBuffer)
+					std::allocator<T>{}.deallocate(Base::heapBuffer, m_mask + 1);
+
+				Base::heapBuffer = std::exchange(ringBuffer.heapBuffer, nullptr);
+				m_head = std::exchange(ringBuffer.m_head, 0);
+				m_mask = std::exchange(ringBuffer.m_mask, Capacity - 1);
+				m_size = std::exchange(ringBuffer.m_size, 0);
+
+				return *this;
+			}
+		}
+
+		// Inline elements are relocated one segment after the other, we may be using a heap buffer big enough to hold them
+		auto segments = ringBuffer.GetSegments();
+		Relocate(GetBuffer(), segments[0].data, segments[0].size);
+		Relocate(GetBuffer() + segments[0].size, segments[1].data, segments[1].size);
+
+		m_size = ringBuffer.m_size;
+		ringBuffer.m_head = 0;
+		ringBuffer.m_size = 0;
+
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	T* FixedRingBuffer<T, Capacity, Growable>::GetBuffer() noexcept
+	{
+		if constexpr (Growable)
+		{
+			if (Base::heapBuffer)
+				return Base::heapBuffer;
+		}
+
+		return std::launder(reinterpret_cast<T*>(&m_data[0]));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	const T* FixedRingBuffer<T, Capacity, Growable>::GetBuffer() const noexcept
+	{
+		if constexpr (Growable)
+		{
+			if (Base::heapBuffer)
+				return Base::heapBuffer;
+		}
+
+		return std::launder(reinterpret_cast<const T*>(&m_data[0]));
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	T* FixedRingBuffer<T, Capacity, Growable>::GetElement(size_type index) noexcept
+	{
+		return GetBuffer() + ((m_head + index) & m_mask);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	const T* FixedRingBuffer<T, Capacity, Growable>::GetElement(size_type index) const noexcept
+	{
+		return GetBuffer() + ((m_head + index) & m_mask);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	void FixedRingBuffer<T, Capacity, Growable>::Grow(size_type capacity)
+	{
+		NazaraAssert(IsPow2(capacity));
+
+		std::allocator<T> allocator;
+		T* newBuffer = allocator.allocate(capacity);
+
+		// Unwrap the elements at the beginning of the new buffer
+		auto segments = GetSegments();
+		Relocate(newBuffer, segments[0].data, segments[0].size);
+		Relocate(newBuffer + segments[0].size, segments[1].data, segments[1].size);
+
+		if (Base::heapBuffer)
+			allocator.deallocate(Base::heapBuffer, m_mask + 1);
+
+		Base::heapBuffer = newBuffer;
+		m_head = 0;
+		m_mask = capacity - 1;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	template<bool C, typename>
+	FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::Iterator(const Iterator<false>& it) :
+	m_ringBuffer(it.m_ringBuffer),
+	m_index(it.m_index)
+	{
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::Iterator(RingBufferType* ringBuffer, size_type index) :
+	m_ringBuffer(ringBuffer),
+	m_index(index)
+	{
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator*() const -> reference
+	{
+		return (*m_ringBuffer)[m_index];
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator->() const -> pointer
+	{
+		return &(*m_ringBuffer)[m_index];
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator[](difference_type n) const -> reference
+	{
+		return (*m_ringBuffer)[m_index + n];
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator++() -> Iterator&
+	{
+		++m_index;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator++(int) -> Iterator
+	{
+		Iterator copy(*this);
+		++m_index;
+		return copy;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator--() -> Iterator&
+	{
+		--m_index;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator--(int) -> Iterator
+	{
+		Iterator copy(*this);
+		--m_index;
+		return copy;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator+=(difference_type n) -> Iterator&
+	{
+		m_index += n;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator-=(difference_type n) -> Iterator&
+	{
+		m_index -= n;
+		return *this;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator+(difference_type n) const -> Iterator
+	{
+		return Iterator(m_ringBuffer, m_index + n);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator-(difference_type n) const -> Iterator
+	{
+		return Iterator(m_ringBuffer, m_index - n);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	auto FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator-(const Iterator& it) const -> difference_type
+	{
+		return static_cast<difference_type>(m_index) - static_cast<difference_type>(it.m_index);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator==(const Iterator& it) const
+	{
+		NazaraAssert(m_ringBuffer == it.m_ringBuffer);
+		return m_index == it.m_index;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator!=(const Iterator& it) const
+	{
+		return !operator==(it);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator<(const Iterator& it) const
+	{
+		NazaraAssert(m_ringBuffer == it.m_ringBuffer);
+		return m_index < it.m_index;
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator<=(const Iterator& it) const
+	{
+		return !it.operator<(*this);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator>(const Iterator& it) const
+	{
+		return it.operator<(*this);
+	}
+
+	template<typename T, std::size_t Capacity, bool Growable>
+	template<bool Const>
+	bool FixedRingBuffer<T, Capacity, Growable>::Iterator<Const>::operator>=(const Iterator& it) const
+	{
+		return !operator<(it);
+	}
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FIXEDSTRING_HPP
+#define NAZARAUTILS_FIXEDSTRING_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Assert.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename CharT, typename Fallback>
+		class FixedStringBase;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback = void>
+	class BasicFixedString : public Detail::FixedStringBase<CharT, Fallback>
+	{
+		static_assert(Capacity > 0);
+		using Base = Detail::FixedStringBase<CharT, Fallback>;
+
+		public:
+			static constexpr std::size_t FixedCapacity = Capacity;
+			using value_type = CharT;
+			using const_iterator = const value_type*;
+			using const_pointer = const value_type*;
+			using const_reference = const value_type&;
+			using difference_type = std::ptrdiff_t;
+			using iterator = value_type*;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using size_type = std::size_t;
+			using string_view_type = std::basic_string_view<CharT>;
+
+			constexpr BasicFixedString();
+			constexpr BasicFixedString(const CharT* str);
+			constexpr BasicFixedString(const CharT* str, size_type length);
+			constexpr BasicFixedString(size_type count, CharT character);
+			constexpr explicit BasicFixedString(string_view_type str);
+			BasicFixedString(const BasicFixedString&) = default;
+			BasicFixedString(BasicFixedString&&) noexcept = default;
+			~BasicFixedString() = default;
+
+			constexpr BasicFixedString& append(const CharT* str, size_type length);
+			constexpr BasicFixedString& append(size_type count, CharT character);
+			constexpr BasicFixedString& append(string_view_type str);
+
+			constexpr BasicFixedString& assign(string_view_type str);
+
+			constexpr reference back();
+			constexpr const_reference back() const;
+
+			constexpr iterator begin() noexcept;
+			constexpr const_iterator begin() const noexcept;
+
+			constexpr const CharT* c_str() const noexcept;
+
+			constexpr size_type capacity() const noexcept;
+
+			constexpr const_iterator cbegin() const noexcept;
+			constexpr const_iterator cend() const noexcept;
+
+			constexpr void clear() noexcept;
+
+			constexpr CharT* data() noexcept;
+			constexpr const CharT* data() const noexcept;
+
+			constexpr bool empty() const noexcept;
+
+			constexpr iterator end() noexcept;
+			constexpr const_iterator end() const noexcept;
+
+			constexpr reference front();
+			constexpr const_reference front() const;
+
+			constexpr size_type length() const noexcept;
+
+			constexpr size_type max_size() const noexcept;
+
+			constexpr void pop_back();
+			constexpr void push_back(CharT character);
+
+			constexpr void reserve(size_type count);
+
+			constexpr void resize(size_type count, CharT character = CharT());
+
+			constexpr size_type size() const noexcept;
+
+			constexpr reference operator[](size_type pos);
+			constexpr const_reference operator[](size_type pos) const;
+
+			BasicFixedString& operator=(const BasicFixedString&) = default;
+			BasicFixedString& operator=(BasicFixedString&&) noexcept = default;
+			constexpr BasicFixedString& operator=(const CharT* str);
+			constexpr BasicFixedString& operator=(string_view_type str);
+
+			constexpr BasicFixedString& operator+=(CharT character);
+			constexpr BasicFixedString& operator+=(const CharT* str);
+			constexpr BasicFixedString& operator+=(string_view_type str);
+
+			constexpr bool operator==(string_view_type str) const noexcept;
+			constexpr bool operator!=(string_view_type str) const noexcept;
+			constexpr bool operator<(string_view_type str) const noexcept;
+
+			constexpr operator string_view_type() const noexcept;
+
+		private:
+			constexpr bool IsUsingFallback() const;
+			constexpr void MoveStorageToFallback(size_type capacity);
+			constexpr void PrepareGrowth(size_type newSize);
+
+			static constexpr void CopyCharacters(CharT* destination, const CharT* source, size_type count);
+
+			// Smallest unsigned type able to store Capacity (and the FallbackInUse marker when a fallback string is used)
+			static constexpr std::size_t MaxStoredSize = (std::is_void_v<Fallback>) ? Capacity : Capacity + 1;
+			using SizeType = UnsignedIntegerType_t<std::max<std::size_t>(RoundToPow2(std::size_t(IntegralLog2(MaxStoredSize)) + 1), 8)>;
+
+			static constexpr SizeType FallbackInUse = Nz::MaxValue();
+
+			SizeType m_size;
+			CharT m_data[Capacity + 1] = {}; //< one more character for the null terminator
+	};
+
+	template<typename CharT, std::size_t Capacity, typename Fallback> constexpr bool operator==(const CharT* lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+	template<typename CharT, std::size_t Capacity, typename Fallback> constexpr bool operator==(std::basic_string_view<CharT> lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+	template<typename CharT, std::size_t Capacity, typename Fallback, typename Allocator> bool operator==(const std::basic_string<CharT, std::char_traits<CharT>, Allocator>& lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+	template<typename CharT, std::size_t Capacity, typename Fallback> constexpr bool operator!=(const CharT* lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+	template<typename CharT, std::size_t Capacity, typename Fallback> constexpr bool operator!=(std::basic_string_view<CharT> lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+	template<typename CharT, std::size_t Capacity, typename Fallback, typename Allocator> bool operator!=(const std::basic_string<CharT, std::char_traits<CharT>, Allocator>& lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept;
+
+	template<std::size_t Capacity>
+	using FixedString = BasicFixedString<char, Capacity>;
+
+	template<std::size_t Capacity>
+	using HybridString = BasicFixedString<char, Capacity, std::string>;
+}
+
+namespace std
+{
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	struct hash<Nz::BasicFixedString<CharT, Capacity, Fallback>>
+	{
+		std::size_t operator()(const Nz::BasicFixedString<CharT, Capacity, Fallback>& str) const;
+	};
+}
+
+#include <NazaraUtils/FixedString.inl>
+
+#endif // NAZARAUTILS_FIXEDSTRING_HPP
@@ -0,0 +1,518 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename CharT, typename Fallback>
+		class FixedStringBase
+		{
+			public:
+				static constexpr bool HasFallback = true;
+
+			protected:
+				Fallback fallback;
+		};
+
+		template<typename CharT>
+		class FixedStringBase<CharT, void>
+		{
+			public:
+				static constexpr bool HasFallback = false;
+		};
+	}
+
+	/*!
+	* \ingroup utils
+	* \class BasicFixedString
+	* \brief Core class that represents a null-terminated string with a compile-time capacity (and thus no allocation required)
+	*
+	* When a Fallback string type is given (see HybridString), characters are moved to it once the fixed capacity is exceeded.
+	* Without fallback (see FixedString), the string is usable in constant expressions.
+	*/
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::BasicFixedString() :
+	m_size(0)
+	{
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::BasicFixedString(const CharT* str) :
+	BasicFixedString(string_view_type(str))
+	{
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::BasicFixedString(const CharT* str, size_type length) :
+	BasicFixedString(string_view_type(str, length))
+	{
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::BasicFixedString(size_type count, CharT character) :
+	BasicFixedString()
+	{
+		append(count, character);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::BasicFixedString(string_view_type str) :
+	BasicFixedString()
+	{
+		append(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::append(const CharT* str, size_type length) -> BasicFixedString&
+	{
+		PrepareGrowth(size() + length);
+
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+			{
+				Base::fallback.append(str, length);
+				return *this;
+			}
+		}
+
+		CopyCharacters(&m_data[m_size], str, length);
+		m_size = static_cast<SizeType>(m_size + length);
+		m_data[m_size] = CharT();
+
+		return *this;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::append(size_type count, CharT character) -> BasicFixedString&
+	{
+		PrepareGrowth(size() + count);
+
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+			{
+				Base::fallback.append(count, character);
+				return *this;
+			}
+		}
+
+		for (size_type i = 0; i < count; ++i)
+			m_data[m_size + i] = character;
+
+		m_size = static_cast<SizeType>(m_size + count);
+		m_data[m_size] = CharT();
+
+		return *this;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::append(string_view_type str) -> BasicFixedString&
+	{
+		return append(str.data(), str.size());
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::assign(string_view_type str) -> BasicFixedString&
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+			{
+				Base::fallback.assign(str.data(), str.size());
+				return *this;
+			}
+		}
+
+		if (str.size() <= Capacity)
+		{
+			// str may be a view of our own characters
+			for (size_type i = 0; i < str.size(); ++i)
+				m_data[i] = str[i];
+
+			m_size = static_cast<SizeType>(str.size());
+			m_data[m_size] = CharT();
+			return *this;
+		}
+
+		clear();
+		return append(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::back() -> reference
+	{
+		NazaraAssert(!empty());
+		return data()[size() - 1];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::back() const -> const_reference
+	{
+		NazaraAssert(!empty());
+		return data()[size() - 1];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::begin() noexcept -> iterator
+	{
+		return data();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::begin() const noexcept -> const_iterator
+	{
+		return data();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr const CharT* BasicFixedString<CharT, Capacity, Fallback>::c_str() const noexcept
+	{
+		return data();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::capacity() const noexcept -> size_type
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+				return Base::fallback.capacity();
+		}
+
+		return Capacity;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::cbegin() const noexcept -> const_iterator
+	{
+		return data();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::cend() const noexcept -> const_iterator
+	{
+		return data() + size();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::clear() noexcept
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+			{
+				Base::fallback.clear();
+				return;
+			}
+		}
+
+		m_size = 0;
+		m_data[0] = CharT();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr CharT* BasicFixedString<CharT, Capacity, Fallback>::data() noexcept
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+				return Base::fallback.data();
+		}
+
+		return &m_data[0];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr const CharT* BasicFixedString<CharT, Capacity, Fallback>::data() const noexcept
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+				return Base::fallback.data();
+		}
+
+		return &m_data[0];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool BasicFixedString<CharT, Capacity, Fallback>::empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::end() noexcept -> iterator
+	{
+		return data() + size();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::end() const noexcept -> const_iterator
+	{
+		return data() + size();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::front() -> reference
+	{
+		NazaraAssert(!empty());
+		return data()[0];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::front() const -> const_reference
+	{
+		NazaraAssert(!empty());
+		return data()[0];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::length() const noexcept -> size_type
+	{
+		return size();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::max_size() const noexcept -> size_type
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+			return Base::fallback.max_size();
+		else
+			return FixedCapacity;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::pop_back()
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+			{
+				Base::fallback.pop_back();
+				return;
+			}
+		}
+
+		NazaraAssert(!empty());
+		m_data[--m_size] = CharT();
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::push_back(CharT character)
+	{
+		append(1, character);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::reserve(size_type count)
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (count <= Capacity)
+				return;
+
+			if (!IsUsingFallback())
+				MoveStorageToFallback(count);
+			else
+				Base::fallback.reserve(count);
+		}
+		else
+		{
+			NazaraAssert(count <= Capacity);
+		}
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::resize(size_type count, CharT character)
+	{
+		size_type currentSize = size();
+		if (count > currentSize)
+			append(count - currentSize, character);
+		else
+		{
+			if constexpr (!std::is_void_v<Fallback>)
+			{
+				if (IsUsingFallback())
+				{
+					Base::fallback.resize(count);
+					return;
+				}
+			}
+
+			m_size = static_cast<SizeType>(count);
+			m_data[m_size] = CharT();
+		}
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::size() const noexcept -> size_type
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (IsUsingFallback())
+				return Base::fallback.size();
+		}
+
+		return m_size;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator[](size_type pos) -> reference
+	{
+		NazaraAssert(pos <= size());
+		return data()[pos];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator[](size_type pos) const -> const_reference
+	{
+		NazaraAssert(pos <= size());
+		return data()[pos];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator=(const CharT* str) -> BasicFixedString&
+	{
+		return assign(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator=(string_view_type str) -> BasicFixedString&
+	{
+		return assign(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator+=(CharT character) -> BasicFixedString&
+	{
+		return append(1, character);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator+=(const CharT* str) -> BasicFixedString&
+	{
+		return append(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr auto BasicFixedString<CharT, Capacity, Fallback>::operator+=(string_view_type str) -> BasicFixedString&
+	{
+		return append(str);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool BasicFixedString<CharT, Capacity, Fallback>::operator==(string_view_type str) const noexcept
+	{
+		return string_view_type(*this) == str;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool BasicFixedString<CharT, Capacity, Fallback>::operator!=(string_view_type str) const noexcept
+	{
+		return string_view_type(*this) != str;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool BasicFixedString<CharT, Capacity, Fallback>::operator<(string_view_type str) const noexcept
+	{
+		return string_view_type(*this) < str;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr BasicFixedString<CharT, Capacity, Fallback>::operator string_view_type() const noexcept
+	{
+		return string_view_type(data(), size());
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool BasicFixedString<CharT, Capacity, Fallback>::IsUsingFallback() const
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+			return m_size == FallbackInUse;
+		else
+			return false;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::MoveStorageToFallback(size_type capacity)
+	{
+		NazaraAssert(!IsUsingFallback());
+
+		Base::fallback.reserve(capacity);
+		Base::fallback.assign(&m_data[0], m_size);
+
+		// Fixed characters are left untouched as they may be viewed by the string being appended
+		m_size = FallbackInUse;
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::PrepareGrowth(size_type newSize)
+	{
+		if constexpr (!std::is_void_v<Fallback>)
+		{
+			if (!IsUsingFallback() && newSize > Capacity)
+				MoveStorageToFallback(newSize);
+		}
+		else
+			NazaraAssertMsg(newSize <= Capacity, "FixedString capacity exceeded");
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr void BasicFixedString<CharT, Capacity, Fallback>::CopyCharacters(CharT* destination, const CharT* source, size_type count)
+	{
+		// std::char_traits<CharT>::copy is only constexpr since C++20, compilers turn this loop into a memcpy anyway
+		for (size_type i = 0; i < count; ++i)
+			destination[i] = source[i];
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool operator==(const CharT* lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) == std::basic_string_view<CharT>(rhs);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool operator==(std::basic_string_view<CharT> lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) == std::basic_string_view<CharT>(rhs);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback, typename Allocator>
+	bool operator==(const std::basic_string<CharT, std::char_traits<CharT>, Allocator>& lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) == std::basic_string_view<CharT>(rhs);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool operator!=(const CharT* lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) != std::basic_string_view<CharT>(rhs);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	constexpr bool operator!=(std::basic_string_view<CharT> lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) != std::basic_string_view<CharT>(rhs);
+	}
+
+	template<typename CharT, std::size_t Capacity, typename Fallback, typename Allocator>
+	bool operator!=(const std::basic_string<CharT, std::char_traits<CharT>, Allocator>& lhs, const BasicFixedString<CharT, Capacity, Fallback>& rhs) noexcept
+	{
+		return std::basic_string_view<CharT>(lhs) != std::basic_string_view<CharT>(rhs);
+	}
+}
+
+namespace std
+{
+	template<typename CharT, std::size_t Capacity, typename Fallback>
+	std::size_t hash<Nz::BasicFixedString<CharT, Capacity, Fallback>>::operator()(const Nz::BasicFixedString<CharT, Capacity, Fallback>& str) const
+	{
+		return hash<std::basic_string_view<CharT>>{}(str);
+	}
+}
@@ -10,9 +10,11 @@
 #include <NazaraUtils/MemoryHelper.hpp>
 #include <NazaraUtils/MathUtils.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <algorithm>
 #include <array>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -24,7 +26,15 @@ namespace Nz
 		class FixedVectorBase;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback = void>
+	template<std::size_t InitialCapacity = 0, std::size_t GrowthNumerator = 2, std::size_t GrowthDenominator = 1>
+	struct GeometricGrowthPolicy
+	{
+		static_assert(GrowthNumerator > GrowthDenominator && GrowthDenominator > 0, "growth factor must be greater than one");
+
+		static constexpr std::size_t ComputeCapacity(std::size_t currentCapacity, std::size_t requiredCapacity);
+	};
+
+	template<typename T, std::size_t Capacity, typename Fallback = void, typename GrowthPolicy = void>
 	class FixedVector : public Detail::FixedVectorBase<T, Fallback>
 	{
 		static_assert(Capacity > 0);
@@ -45,6 +55,7 @@ namespace Nz
 			using size_type = std::size_t;
 
 			constexpr FixedVector();
+			template<typename F = Fallback, typename = std::enable_if_t<!std::is_void_v<F>>> constexpr explicit FixedVector(const typename F::allocator_type& allocator);
 			constexpr explicit FixedVector(size_type size, const T& value = T{});
 			template<typename InputIt> constexpr FixedVector(InputIt first, InputIt last);
 			constexpr FixedVector(std::initializer_list<T> init);
@@ -104,6 +115,8 @@ namespace Nz
 
 			constexpr void reserve(size_type count);
 
+			constexpr void shrink_to_fit();
+
 			constexpr reverse_iterator rbegin() noexcept;
 			constexpr const_reverse_iterator rbegin() const noexcept;
 
@@ -120,17 +133,22 @@ namespace Nz
 
 		private:
 			constexpr bool CheckFallbackOnGrow();
+			constexpr void GrowFallback(std::size_t requiredCapacity);
 			constexpr bool IsUsingFallback() const;
 			constexpr void MoveStorageToFallback(std::size_t capacity);
 
-			static constexpr std::size_t FallbackInUse = Nz::MaxValue();
+			// Smallest unsigned type able to store Capacity (and the FallbackInUse marker when a fallback container is used)
+			static constexpr std::size_t MaxStoredSize = (std::is_void_v<Fallback>) ? Capacity : Capacity + 1;
+			using SizeType = UnsignedIntegerType_t<std::max<std::size_t>(RoundToPow2(std::size_t(IntegralLog2(MaxStoredSize)) + 1), 8)>;
+
+			static constexpr SizeType FallbackInUse = Nz::MaxValue();
 
-			std::size_t m_size;
+			SizeType m_size;
 			alignas(T) std::array<std::byte, sizeof(T) * Capacity> m_data;
 	};
 
-	template<typename T, std::size_t Capacity>
-	using HybridVector = FixedVector<T, Capacity, std::vector<T>>;
+	template<typename T, std::size_t Capacity, typename Allocator = std::allocator<T>, typename GrowthPolicy = void>
+	using HybridVector = FixedVector<T, Capacity, std::vector<T, Allocator>, GrowthPolicy>;
 }
 
 #include <NazaraUtils/FixedVector.inl>
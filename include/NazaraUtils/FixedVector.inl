@@ -18,6 +18,13 @@ namespace Nz
 				static constexpr bool HasFallback = true;
 
 			protected:
+				FixedVectorBase() = default;
+
+				explicit FixedVectorBase(const typename Fallback::allocator_type& allocator) :
+				fallback(allocator)
+				{
+				}
+
 				void ClearFallback()
 				{ 
 					fallback.clear();
@@ -37,6 +44,11 @@ namespace Nz
 					return &fallback.back();
 				}
 
+				void MoveBackInFallback(T* first, T* last)
+				{
+					fallback.insert(fallback.end(), std::make_move_iterator(first), std::make_move_iterator(last));
+				}
+
 				std::size_t EraseInFallback(std::size_t n)
 				{
 					auto it = fallback.erase(fallback.begin() + n);
@@ -94,6 +106,11 @@ namespace Nz
 					fallback.resize(size, value);
 				}
 
+				void ShrinkFallback()
+				{
+					fallback.shrink_to_fit();
+				}
+
 				Fallback fallback;
 		};
 
@@ -120,6 +137,10 @@ namespace Nz
 					return nullptr;
 				}
 
+				void MoveBackInFallback(T* /*first*/, T* /*last*/)
+				{
+				}
+
 				std::size_t EraseInFallback(std::size_t /*n*/)
 				{
 					return 0;
@@ -170,45 +191,81 @@ namespace Nz
 				void ResizeFallback(std::size_t /*size*/, const T& /*value*/)
 				{
 				}
+
+				void ShrinkFallback()
+				{
+				}
 		};
 	}
 
+	/*!
+	* \ingroup utils
+	* \class GeometricGrowthPolicy
+	* \brief Growth policy for FixedVector fallback containers, multiplying the capacity by GrowthNumerator / GrowthDenominator each time it runs out
+	*
+	* \remark InitialCapacity is the minimum capacity reserved when spilling the fixed storage into the fallback container
+	*/
+	template<std::size_t InitialCapacity, std::size_t GrowthNumerator, std::size_t GrowthDenominator>
+	constexpr std::size_t GeometricGrowthPolicy<InitialCapacity, GrowthNumerator, GrowthDenominator>::ComputeCapacity(std::size_t currentCapacity, std::size_t requiredCapacity)
+	{
+		return std::max({ requiredCapacity, currentCapacity * GrowthNumerator / GrowthDenominator, InitialCapacity });
+	}
+
 	/*!
 	* \ingroup utils
 	* \class FixedVector
 	* \brief Core class that represents an inplace vector with a compile-time capacity (and thus no allocation required)
+	*
+	* When a Fallback container is given (see HybridVector), elements are moved to it once the fixed capacity is exceeded.
+	* If GrowthPolicy is not void, it controls the fallback capacity through its static ComputeCapacity(currentCapacity, requiredCapacity) function,
+	* otherwise the fallback container grows on its own.
 	*/
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr FixedVector<T, Capacity, Fallback>::FixedVector() :
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector() :
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs an empty vector whose fallback container will use the given allocator
+	*
+	* \param allocator Allocator passed to the fallback container, used once the fixed capacity is exceeded
+	*
+	* \remark Only available for vectors with a fallback container (such as HybridVector)
+	*/
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	template<typename F, typename>
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(const typename F::allocator_type& allocator) :
+	Base(allocator),
 	m_size(0)
 	{
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr FixedVector<T, Capacity, Fallback>::FixedVector(size_type size, const T& value) :
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(size_type size, const T& value) :
 	FixedVector()
 	{
 		resize(size, value);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
 	template<typename InputIt>
-	constexpr FixedVector<T, Capacity, Fallback>::FixedVector(InputIt first, InputIt last) :
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(InputIt first, InputIt last) :
 	FixedVector()
 	{
 		while (first != last)
 			emplace_back(*first++);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	inline constexpr FixedVector<T, Capacity, Fallback>::FixedVector(std::initializer_list<T> init) :
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	inline constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(std::initializer_list<T> init) :
 	FixedVector(init.begin(), init.end())
 	{
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr FixedVector<T, Capacity, Fallback>::FixedVector(const FixedVector& vec) :
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(const FixedVector& vec) :
 	Base(vec)
 	{
 		if (!vec.IsUsingFallback())
@@ -221,54 +278,63 @@ namespace Nz
 			m_size = FallbackInUse;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr FixedVector<T, Capacity, Fallback>::FixedVector(FixedVector&& vec) noexcept :
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr FixedVector<T, Capacity, Fallback, GrowthPolicy>::FixedVector(FixedVector&& vec) noexcept :
 	Base(std::move(vec))
 	{
 		if (!vec.IsUsingFallback())
 		{
-			m_size = 0;
-			for (size_type i = 0; i < vec.size(); ++i)
-				push_back(std::move(vec[i]));
+			if constexpr (IsTriviallyRelocatable_v<T>)
+			{
+				m_size = vec.m_size;
+				Relocate(data(), vec.data(), m_size);
+				vec.m_size = 0;
+			}
+			else
+			{
+				m_size = 0;
+				for (size_type i = 0; i < vec.size(); ++i)
+					push_back(std::move(vec[i]));
+			}
 		}
 		else
 			m_size = FallbackInUse;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	FixedVector<T, Capacity, Fallback>::~FixedVector()
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	FixedVector<T, Capacity, Fallback, GrowthPolicy>::~FixedVector()
 	{
 		clear();
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::back() -> reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::back() -> reference
 	{
 		assert(!empty());
 		return *data(size() - 1);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::back() const -> const_reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::back() const -> const_reference
 	{
 		assert(!empty());
 		return *data(size() - 1);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::begin() noexcept -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::begin() noexcept -> iterator
 	{
 		return iterator(data());
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::begin() const noexcept -> const_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::begin() const noexcept -> const_iterator
 	{
 		return const_iterator(data());
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::capacity() const noexcept -> size_type
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::capacity() const noexcept -> size_type
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -279,8 +345,8 @@ namespace Nz
 		return Capacity;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::clear() noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::clear() noexcept
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -298,38 +364,38 @@ namespace Nz
 		m_size = 0;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::cbegin() const noexcept -> const_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::cbegin() const noexcept -> const_iterator
 	{
 		return const_iterator(data());
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::cend() const noexcept -> const_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::cend() const noexcept -> const_iterator
 	{
 		return const_iterator(data(size()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::crbegin() const noexcept -> const_reverse_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::crbegin() const noexcept -> const_reverse_iterator
 	{
 		return const_reverse_iterator(data(size()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::crend() const noexcept -> const_reverse_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::crend() const noexcept -> const_reverse_iterator
 	{
 		return const_reverse_iterator(data());
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr T* FixedVector<T, Capacity, Fallback>::data() noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr T* FixedVector<T, Capacity, Fallback, GrowthPolicy>::data() noexcept
 	{
 		return data(0);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr T* FixedVector<T, Capacity, Fallback>::data(size_type n) noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr T* FixedVector<T, Capacity, Fallback, GrowthPolicy>::data(size_type n) noexcept
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -340,14 +406,14 @@ namespace Nz
 		return std::launder(reinterpret_cast<T*>(&m_data[0]) + n);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr const T* FixedVector<T, Capacity, Fallback>::data() const noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr const T* FixedVector<T, Capacity, Fallback, GrowthPolicy>::data() const noexcept
 	{
 		return data(0);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr const T* FixedVector<T, Capacity, Fallback>::data(size_type n) const noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr const T* FixedVector<T, Capacity, Fallback, GrowthPolicy>::data(size_type n) const noexcept
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -358,9 +424,9 @@ namespace Nz
 		return std::launder(reinterpret_cast<const T*>(&m_data[0]) + n);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
 	template<typename... Args>
-	constexpr auto FixedVector<T, Capacity, Fallback>::emplace(const_iterator pos, Args&& ...args) -> iterator
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::emplace(const_iterator pos, Args&& ...args) -> iterator
 	{
 		NazaraAssert(pos >= begin() && pos <= end());
 		std::size_t index = std::distance(cbegin(), pos);
@@ -372,6 +438,15 @@ namespace Nz
 		}
 
 		NazaraAssert(m_size < Capacity);
+		if constexpr (IsTriviallyRelocatable_v<T> && std::is_nothrow_constructible_v<T, Args&&...>)
+		{
+			// Shift elements with a single memmove, constructing the new element can't fail
+			Relocate(data(index + 1), data(index), m_size - index);
+			m_size++;
+
+			return PlacementNew(data(index), std::forward<Args>(args)...);
+		}
+
 		if (pos < end())
 		{
 			iterator lastElement = end() - 1;
@@ -387,9 +462,9 @@ namespace Nz
 		return PlacementNew(data(index), std::forward<Args>(args)...);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
 	template<typename... Args>
-	constexpr auto FixedVector<T, Capacity, Fallback>::emplace_back(Args&&... args) -> reference
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::emplace_back(Args&&... args) -> reference
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -401,8 +476,8 @@ namespace Nz
 		return *PlacementNew(data(m_size++), std::forward<Args>(args)...);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr bool FixedVector<T, Capacity, Fallback>::empty() const noexcept
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr bool FixedVector<T, Capacity, Fallback, GrowthPolicy>::empty() const noexcept
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -413,20 +488,20 @@ namespace Nz
 		return m_size == 0;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::end() noexcept -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::end() noexcept -> iterator
 	{
 		return iterator(data(size()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::end() const noexcept -> const_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::end() const noexcept -> const_iterator
 	{
 		return const_iterator(data(size()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::erase(const_iterator pos) -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::erase(const_iterator pos) -> iterator
 	{
 		NazaraAssert(pos < end());
 		std::size_t index = std::distance(cbegin(), pos);
@@ -437,14 +512,23 @@ namespace Nz
 				return begin() + Base::EraseInFallback(index);
 		}
 
-		std::move(begin() + index + 1, end(), begin() + index);
-		pop_back();
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			PlacementDestroy(data(index));
+			Relocate(data(index), data(index + 1), m_size - index - 1);
+			m_size--;
+		}
+		else
+		{
+			std::move(begin() + index + 1, end(), begin() + index);
+			pop_back();
+		}
 
 		return iterator(data(index));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::erase(const_iterator first, const_iterator last) -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::erase(const_iterator first, const_iterator last) -> iterator
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -466,40 +550,51 @@ namespace Nz
 
 		std::size_t count = std::distance(first, last);
 
-		std::move(begin() + index + count, end(), begin() + index);
-		resize(size() - count);
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			for (std::size_t i = index; i < index + count; ++i)
+				PlacementDestroy(data(i));
+
+			Relocate(data(index), data(index + count), m_size - index - count);
+			m_size = static_cast<SizeType>(m_size - count);
+		}
+		else
+		{
+			std::move(begin() + index + count, end(), begin() + index);
+			resize(size() - count);
+		}
 
 		return iterator(data(index));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::front() noexcept -> reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::front() noexcept -> reference
 	{
 		NazaraAssert(!empty());
 		return *data();
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::front() const noexcept -> const_reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::front() const noexcept -> const_reference
 	{
 		NazaraAssert(!empty());
 		return *data();
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::insert(const_iterator pos, const T& value) -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::insert(const_iterator pos, const T& value) -> iterator
 	{
 		return emplace(pos, value);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::insert(const_iterator pos, T&& value) -> iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::insert(const_iterator pos, T&& value) -> iterator
 	{
 		return emplace(pos, std::move(value));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::max_size() const noexcept -> size_type
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::max_size() const noexcept -> size_type
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 			return Base::GetFallbackMaxSize();
@@ -507,8 +602,8 @@ namespace Nz
 			return FixedCapacity;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::push_back(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value) -> reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::push_back(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value) -> reference
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -520,21 +615,21 @@ namespace Nz
 		return *PlacementNew(data(m_size++), value);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::push_back(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value) -> reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::push_back(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value) -> reference
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
 			if (CheckFallbackOnGrow())
-				return *Base::EmplaceBackInFallback(value);
+				return *Base::EmplaceBackInFallback(std::move(value));
 		}
 
 		NazaraAssert(m_size < Capacity);
 		return *PlacementNew(data(m_size++), std::move(value));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::pop_back()
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::pop_back()
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -549,13 +644,14 @@ namespace Nz
 		PlacementDestroy(data(--m_size));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::resize(size_type count)
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::resize(size_type count)
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
 			if (IsUsingFallback())
 			{
+				GrowFallback(count);
 				Base::ResizeFallback(count);
 				return;
 			}
@@ -573,24 +669,25 @@ namespace Nz
 			for (std::size_t i = m_size; i < count; ++i)
 				PlacementNew(data(i));
 
-			m_size = count;
+			m_size = static_cast<SizeType>(count);
 		}
 		else if (count < m_size)
 		{
 			for (std::size_t i = count; i < m_size; ++i)
 				PlacementDestroy(data(i));
 
-			m_size = count;
+			m_size = static_cast<SizeType>(count);
 		}
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::resize(size_type count, const value_type& value)
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::resize(size_type count, const value_type& value)
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
 			if (IsUsingFallback())
 			{
+				GrowFallback(count);
 				Base::ResizeFallback(count, value);
 				return;
 			}
@@ -608,19 +705,19 @@ namespace Nz
 			for (std::size_t i = m_size; i < count; ++i)
 				PlacementNew(data(i), value);
 
-			m_size = count;
+			m_size = static_cast<SizeType>(count);
 		}
 		else if (count < m_size)
 		{
 			for (std::size_t i = count; i < m_size; ++i)
 				PlacementDestroy(data(i));
 
-			m_size = count;
+			m_size = static_cast<SizeType>(count);
 		}
 	}
 	
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::reserve(size_type count)
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::reserve(size_type count)
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -638,32 +735,66 @@ namespace Nz
 		}
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::rbegin() noexcept -> reverse_iterator
+	/*!
+	* \brief Releases unused fallback memory
+	*
+	* If the elements fit in the fixed capacity again, they are moved back inline and the fallback container memory is released.
+	* Otherwise the fallback container is asked to shrink its capacity to its size.
+	*/
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::shrink_to_fit()
+	{
+		if constexpr (!std::is_same_v<Fallback, void>)
+		{
+			if (!IsUsingFallback())
+				return;
+
+			std::size_t size = Base::GetFallbackSize();
+			if (size <= Capacity)
+			{
+				T* fallbackData = Base::GetFallbackData(0);
+
+				// data() now points to the fixed storage
+				m_size = 0;
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					PlacementNew(data(i), std::move(fallbackData[i]));
+					m_size++;
+				}
+
+				Base::ClearFallback();
+			}
+
+			Base::ShrinkFallback();
+		}
+	}
+
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::rbegin() noexcept -> reverse_iterator
 	{
 		return reverse_iterator(iterator(data(size())));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::rbegin() const noexcept -> const_reverse_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::rbegin() const noexcept -> const_reverse_iterator
 	{
 		return reverse_iterator(iterator(data(size())));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::rend() noexcept -> reverse_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::rend() noexcept -> reverse_iterator
 	{
 		return reverse_iterator(iterator(data()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::rend() const noexcept -> const_reverse_iterator
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::rend() const noexcept -> const_reverse_iterator
 	{
 		return reverse_iterator(iterator(data()));
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::size() const noexcept -> size_type
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::size() const noexcept -> size_type
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -674,22 +805,22 @@ namespace Nz
 		return m_size;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::operator[](size_type pos) -> reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::operator[](size_type pos) -> reference
 	{
 		NazaraAssert(pos < size());
 		return *data(pos);
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::operator[](size_type pos) const -> const_reference
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::operator[](size_type pos) const -> const_reference
 	{
 		NazaraAssert(pos < size());
 		return *data(pos);
 	}
 	
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::operator=(const FixedVector& vec) -> FixedVector&
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::operator=(const FixedVector& vec) -> FixedVector&
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -709,8 +840,8 @@ namespace Nz
 		return *this;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr auto FixedVector<T, Capacity, Fallback>::operator=(FixedVector&& vec) noexcept -> FixedVector&
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr auto FixedVector<T, Capacity, Fallback, GrowthPolicy>::operator=(FixedVector&& vec) noexcept -> FixedVector&
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
@@ -724,6 +855,19 @@ namespace Nz
 		}
 
 		clear();
+
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			if (!IsUsingFallback())
+			{
+				Relocate(data(), vec.data(), vec.m_size);
+				m_size = vec.m_size;
+				vec.m_size = 0;
+
+				return *this;
+			}
+		}
+
 		reserve(vec.size());
 		for (size_type i = 0; i < vec.size(); ++i)
 			push_back(std::move(vec[i]));
@@ -731,13 +875,16 @@ namespace Nz
 		return *this;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr bool FixedVector<T, Capacity, Fallback>::CheckFallbackOnGrow()
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr bool FixedVector<T, Capacity, Fallback, GrowthPolicy>::CheckFallbackOnGrow()
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 		{
 			if (IsUsingFallback())
+			{
+				GrowFallback(Base::GetFallbackSize() + 1);
 				return true;
+			}
 
 			if (m_size >= Capacity)
 			{
@@ -751,8 +898,19 @@ namespace Nz
 			return false;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr bool FixedVector<T, Capacity, Fallback>::IsUsingFallback() const
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::GrowFallback(std::size_t requiredCapacity)
+	{
+		if constexpr (!std::is_same_v<GrowthPolicy, void>)
+		{
+			std::size_t currentCapacity = Base::GetFallbackCapacity();
+			if (requiredCapacity > currentCapacity)
+				Base::ReserveFallback(GrowthPolicy::ComputeCapacity(currentCapacity, requiredCapacity));
+		}
+	}
+
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr bool FixedVector<T, Capacity, Fallback, GrowthPolicy>::IsUsingFallback() const
 	{
 		if constexpr (!std::is_same_v<Fallback, void>)
 			return m_size == FallbackInUse;
@@ -760,18 +918,21 @@ namespace Nz
 			return false;
 	}
 
-	template<typename T, std::size_t Capacity, typename Fallback>
-	constexpr void FixedVector<T, Capacity, Fallback>::MoveStorageToFallback(std::size_t capacity)
+	template<typename T, std::size_t Capacity, typename Fallback, typename GrowthPolicy>
+	constexpr void FixedVector<T, Capacity, Fallback, GrowthPolicy>::MoveStorageToFallback(std::size_t capacity)
 	{
 		NazaraAssert(!IsUsingFallback());
 
+		if constexpr (!std::is_same_v<GrowthPolicy, void>)
+			capacity = GrowthPolicy::ComputeCapacity(Capacity, capacity);
+
 		Base::ReserveFallback(capacity);
+
+		// Move elements at once to let the fallback container use a memcpy for trivially copyable types
+		Base::MoveBackInFallback(data(0), data(m_size));
 		for (std::size_t i = 0; i < m_size; ++i)
-		{
-			T* ptr = data(i);
-			Base::EmplaceBackInFallback(std::move(*ptr));
-			PlacementDestroy(ptr);
-		}
+			PlacementDestroy(data(i));
+
 		m_size = FallbackInUse;
 	}
 }
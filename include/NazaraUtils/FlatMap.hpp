@@ -0,0 +1,179 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FLATMAP_HPP
+#define NAZARAUTILS_FLATMAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/FlatSet.hpp>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare = std::less<>>
+	class FlatMap
+	{
+		public:
+			template<bool Const> class Iterator;
+
+			using const_iterator = Iterator<true>;
+			using iterator = Iterator<false>;
+			using key_compare = Compare;
+			using key_container_type = KeyContainer;
+			using key_type = Key;
+			using mapped_container_type = ValueContainer;
+			using mapped_type = Value;
+			using size_type = std::size_t;
+			using value_type = std::pair<Key, Value>;
+
+			FlatMap() = default;
+			explicit FlatMap(const Compare& compare);
+			FlatMap(std::initializer_list<value_type> values, const Compare& compare = Compare());
+			FlatMap(const FlatMap&) = default;
+			FlatMap(FlatMap&&) noexcept = default;
+			~FlatMap() = default;
+
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+
+			const_iterator cbegin() const noexcept;
+			const_iterator cend() const noexcept;
+
+			void clear() noexcept;
+
+			bool contains(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> bool contains(const K& key) const;
+
+			bool empty() const noexcept;
+
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+
+			iterator erase(const_iterator pos);
+			size_type erase(const Key& key);
+
+			iterator find(const Key& key);
+			const_iterator find(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> iterator find(const K& key);
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> const_iterator find(const K& key) const;
+
+			std::pair<iterator, bool> insert(const value_type& value);
+			std::pair<iterator, bool> insert(value_type&& value);
+			template<typename V> std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value);
+			template<typename V> std::pair<iterator, bool> insert_or_assign(Key&& key, V&& value);
+
+			const KeyContainer& keys() const noexcept;
+
+			iterator lower_bound(const Key& key);
+			const_iterator lower_bound(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> iterator lower_bound(const K& key);
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> const_iterator lower_bound(const K& key) const;
+
+			void reserve(size_type count);
+
+			size_type size() const noexcept;
+
+			template<typename... Args> std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+			template<typename... Args> std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+
+			const ValueContainer& values() const noexcept;
+
+			Value& operator[](const Key& key);
+			Value& operator[](Key&& key);
+
+			FlatMap& operator=(const FlatMap&) = default;
+			FlatMap& operator=(FlatMap&&) noexcept = default;
+
+			template<bool Const>
+			class Iterator
+			{
+				friend FlatMap;
+				template<bool> friend class Iterator;
+
+				public:
+					using ValueRef = std::conditional_t<Const, const Value&, Value&>;
+
+					class ArrowProxy
+					{
+						public:
+							ArrowProxy(std::pair<const Key&, ValueRef> pair);
+
+							std::pair<const Key&, ValueRef>* operator->();
+
+						private:
+							std::pair<const Key&, ValueRef> m_pair;
+					};
+
+					using difference_type = std::ptrdiff_t;
+					using iterator_category = std::random_access_iterator_tag;
+					using pointer = ArrowProxy;
+					using reference = std::pair<const Key&, ValueRef>;
+					using value_type = FlatMap::value_type;
+
+					Iterator() = default;
+					template<bool C = Const, typename = std::enable_if_t<C>> Iterator(const Iterator<false>& it);
+					Iterator(const Iterator&) = default;
+					~Iterator() = default;
+
+					Iterator& operator=(const Iterator&) = default;
+
+					reference operator*() const;
+					ArrowProxy operator->() const;
+					reference operator[](difference_type n) const;
+
+					Iterator& operator++();
+					Iterator operator++(int);
+					Iterator& operator--();
+					Iterator operator--(int);
+
+					Iterator& operator+=(difference_type n);
+					Iterator& operator-=(difference_type n);
+					Iterator operator+(difference_type n) const;
+					Iterator operator-(difference_type n) const;
+					difference_type operator-(const Iterator& it) const;
+
+					bool operator==(const Iterator& it) const;
+					bool operator!=(const Iterator& it) const;
+					bool operator<(const Iterator& it) const;
+
+				private:
+					using ValuePtr = std::conditional_t<Const, const Value*, Value*>;
+
+					Iterator(const Key* key, ValuePtr value);
+
+					const Key* m_key = nullptr;
+					ValuePtr m_value = nullptr;
+			};
+
+		private:
+			template<typename K, typename... Args> iterator EmplaceAt(size_type index, K&& key, Args&&... args);
+			template<typename K> size_type FindIndex(const K& key) const;
+			template<typename K, typename V> std::pair<iterator, bool> InsertOrAssign(K&& key, V&& value);
+			iterator IteratorAt(size_type index);
+			const_iterator IteratorAt(size_type index) const;
+			template<typename K> size_type LowerBoundIndex(const K& key) const;
+			template<typename K, typename... Args> std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args);
+
+			Compare m_compare;
+			KeyContainer m_keys;
+			ValueContainer m_values;
+	};
+
+	template<typename Key, typename Value, std::size_t Capacity, typename Compare = std::less<>>
+	using FixedFlatMap = FlatMap<Key, Value, FixedVector<Key, Capacity>, FixedVector<Value, Capacity>, Compare>;
+
+	template<typename Key, typename Value, std::size_t Capacity, typename Compare = std::less<>>
+	using HybridFlatMap = FlatMap<Key, Value, HybridVector<Key, Capacity>, HybridVector<Value, Capacity>, Compare>;
+}
+
+#include <NazaraUtils/FlatMap.inl>
+
+#endif // NAZARAUTILS_FLATMAP_HPP
@@ -0,0 +1,467 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/CallOnExit.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class FlatMap
+	* \brief Sorted associative container storing its keys and values contiguously in two separate vector-like containers
+	*
+	* Keys are searched with the same algorithm as FlatSet, values are only touched once their key has been found.
+	* FixedFlatMap and HybridFlatMap store their keys and values in FixedVector and HybridVector, small maps never allocate.
+	*
+	* \remark Heterogeneous lookup is available if Compare has an is_transparent member type (which is the case of the default std::less<>)
+	* \remark Iterators dereference to a std::pair of references to the key and value
+	*/
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::FlatMap(const Compare& compare) :
+	m_compare(compare)
+	{
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::FlatMap(std::initializer_list<value_type> values, const Compare& compare) :
+	m_compare(compare)
+	{
+		reserve(values.size());
+		for (const value_type& value : values)
+			insert(value);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::begin() noexcept -> iterator
+	{
+		return IteratorAt(0);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::begin() const noexcept -> const_iterator
+	{
+		return IteratorAt(0);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::cbegin() const noexcept -> const_iterator
+	{
+		return IteratorAt(0);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::cend() const noexcept -> const_iterator
+	{
+		return IteratorAt(m_keys.size());
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	void FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::clear() noexcept
+	{
+		m_keys.clear();
+		m_values.clear();
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::contains(const Key& key) const
+	{
+		return FindIndex(key) != m_keys.size();
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename C, typename>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::contains(const K& key) const
+	{
+		return FindIndex(key) != m_keys.size();
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::empty() const noexcept
+	{
+		return m_keys.empty();
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::end() noexcept -> iterator
+	{
+		return IteratorAt(m_keys.size());
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::end() const noexcept -> const_iterator
+	{
+		return IteratorAt(m_keys.size());
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::erase(const_iterator pos) -> iterator
+	{
+		size_type index = static_cast<size_type>(pos - cbegin());
+		NazaraAssert(index < m_keys.size());
+
+		m_keys.erase(m_keys.begin() + index);
+		m_values.erase(m_values.begin() + index);
+
+		return IteratorAt(index);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::erase(const Key& key) -> size_type
+	{
+		size_type index = FindIndex(key);
+		if (index == m_keys.size())
+			return 0;
+
+		m_keys.erase(m_keys.begin() + index);
+		m_values.erase(m_values.begin() + index);
+		return 1;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::find(const Key& key) -> iterator
+	{
+		return IteratorAt(FindIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::find(const Key& key) const -> const_iterator
+	{
+		return IteratorAt(FindIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::find(const K& key) -> iterator
+	{
+		return IteratorAt(FindIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::find(const K& key) const -> const_iterator
+	{
+		return IteratorAt(FindIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::insert(const value_type& value) -> std::pair<iterator, bool>
+	{
+		return TryEmplace(value.first, value.second);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::insert(value_type&& value) -> std::pair<iterator, bool>
+	{
+		return TryEmplace(std::move(value.first), std::move(value.second));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename V>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::insert_or_assign(const Key& key, V&& value) -> std::pair<iterator, bool>
+	{
+		return InsertOrAssign(key, std::forward<V>(value));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename V>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::insert_or_assign(Key&& key, V&& value) -> std::pair<iterator, bool>
+	{
+		return InsertOrAssign(std::move(key), std::forward<V>(value));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	const KeyContainer& FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::keys() const noexcept
+	{
+		return m_keys;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::lower_bound(const Key& key) -> iterator
+	{
+		return IteratorAt(LowerBoundIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::lower_bound(const Key& key) const -> const_iterator
+	{
+		return IteratorAt(LowerBoundIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::lower_bound(const K& key) -> iterator
+	{
+		return IteratorAt(LowerBoundIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::lower_bound(const K& key) const -> const_iterator
+	{
+		return IteratorAt(LowerBoundIndex(key));
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	void FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::reserve(size_type count)
+	{
+		m_keys.reserve(count);
+		m_values.reserve(count);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::size() const noexcept -> size_type
+	{
+		return m_keys.size();
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename... Args>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::try_emplace(const Key& key, Args&&... args) -> std::pair<iterator, bool>
+	{
+		return TryEmplace(key, std::forward<Args>(args)...);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename... Args>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::try_emplace(Key&& key, Args&&... args) -> std::pair<iterator, bool>
+	{
+		return TryEmplace(std::move(key), std::forward<Args>(args)...);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	const ValueContainer& FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::values() const noexcept
+	{
+		return m_values;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	Value& FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::operator[](const Key& key)
+	{
+		return TryEmplace(key).first.m_value[0];
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	Value& FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::operator[](Key&& key)
+	{
+		return TryEmplace(std::move(key)).first.m_value[0];
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename... Args>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::EmplaceAt(size_type index, K&& key, Args&&... args) -> iterator
+	{
+		m_keys.emplace(m_keys.begin() + index, std::forward<K>(key));
+
+		// Remove the key if the value cannot be inserted, keys and values must stay in sync
+		CallOnExit eraseKey([&] { m_keys.erase(m_keys.begin() + index); });
+		m_values.emplace(m_values.begin() + index, std::forward<Args>(args)...);
+		eraseKey.Reset();
+
+		return IteratorAt(index);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::FindIndex(const K& key) const -> size_type
+	{
+		size_type index = LowerBoundIndex(key);
+		if (index != m_keys.size() && m_compare(key, m_keys[index]))
+			return m_keys.size();
+
+		return index;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename V>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::InsertOrAssign(K&& key, V&& value) -> std::pair<iterator, bool>
+	{
+		size_type index = LowerBoundIndex(key);
+		if (index != m_keys.size() && !m_compare(key, m_keys[index]))
+		{
+			m_values[index] = std::forward<V>(value);
+			return { IteratorAt(index), false };
+		}
+
+		return { EmplaceAt(index, std::forward<K>(key), std::forward<V>(value)), true };
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::IteratorAt(size_type index) -> iterator
+	{
+		return iterator(m_keys.data() + index, m_values.data() + index);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::IteratorAt(size_type index) const -> const_iterator
+	{
+		return const_iterator(m_keys.data() + index, m_values.data() + index);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::LowerBoundIndex(const K& key) const -> size_type
+	{
+		return Detail::FlatLowerBound(m_keys.data(), m_keys.size(), key, m_compare);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<typename K, typename... Args>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::TryEmplace(K&& key, Args&&... args) -> std::pair<iterator, bool>
+	{
+		size_type index = LowerBoundIndex(key);
+		if (index != m_keys.size() && !m_compare(key, m_keys[index]))
+			return { IteratorAt(index), false };
+
+		return { EmplaceAt(index, std::forward<K>(key), std::forward<Args>(args)...), true };
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::ArrowProxy::ArrowProxy(std::pair<const Key&, ValueRef> pair) :
+	m_pair(pair)
+	{
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::ArrowProxy::operator->() -> std::pair<const Key&, ValueRef>*
+	{
+		return &m_pair;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	template<bool C, typename>
+	FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::Iterator(const Iterator<false>& it) :
+	m_key(it.m_key),
+	m_value(it.m_value)
+	{
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::Iterator(const Key* key, ValuePtr value) :
+	m_key(key),
+	m_value(value)
+	{
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator*() const -> reference
+	{
+		return reference(*m_key, *m_value);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator->() const -> ArrowProxy
+	{
+		return ArrowProxy(operator*());
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator[](difference_type n) const -> reference
+	{
+		return reference(m_key[n], m_value[n]);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator++() -> Iterator&
+	{
+		++m_key;
+		++m_value;
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator++(int) -> Iterator
+	{
+		Iterator copy(*this);
+		operator++();
+		return copy;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator--() -> Iterator&
+	{
+		--m_key;
+		--m_value;
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator--(int) -> Iterator
+	{
+		Iterator copy(*this);
+		operator--();
+		return copy;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator+=(difference_type n) -> Iterator&
+	{
+		m_key += n;
+		m_value += n;
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator-=(difference_type n) -> Iterator&
+	{
+		m_key -= n;
+		m_value -= n;
+		return *this;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator+(difference_type n) const -> Iterator
+	{
+		return Iterator(m_key + n, m_value + n);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator-(difference_type n) const -> Iterator
+	{
+		return Iterator(m_key - n, m_value - n);
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	auto FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator-(const Iterator& it) const -> difference_type
+	{
+		return m_key - it.m_key;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator==(const Iterator& it) const
+	{
+		return m_key == it.m_key;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator!=(const Iterator& it) const
+	{
+		return m_key != it.m_key;
+	}
+
+	template<typename Key, typename Value, typename KeyContainer, typename ValueContainer, typename Compare>
+	template<bool Const>
+	bool FlatMap<Key, Value, KeyContainer, ValueContainer, Compare>::Iterator<Const>::operator<(const Iterator& it) const
+	{
+		return m_key < it.m_key;
+	}
+}
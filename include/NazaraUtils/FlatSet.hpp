@@ -0,0 +1,94 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FLATSET_HPP
+#define NAZARAUTILS_FLATSET_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FixedVector.hpp>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename Key, typename K, typename Compare> std::size_t FlatLowerBound(const Key* keys, std::size_t keyCount, const K& key, const Compare& compare);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare = std::less<>>
+	class FlatSet
+	{
+		public:
+			using const_iterator = typename KeyContainer::const_iterator;
+			using container_type = KeyContainer;
+			using iterator = const_iterator;
+			using key_compare = Compare;
+			using key_type = Key;
+			using size_type = std::size_t;
+			using value_type = Key;
+
+			FlatSet() = default;
+			explicit FlatSet(const Compare& compare);
+			FlatSet(std::initializer_list<Key> keys, const Compare& compare = Compare());
+			FlatSet(const FlatSet&) = default;
+			FlatSet(FlatSet&&) noexcept = default;
+			~FlatSet() = default;
+
+			const_iterator begin() const noexcept;
+
+			void clear() noexcept;
+
+			bool contains(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> bool contains(const K& key) const;
+
+			template<typename... Args> std::pair<iterator, bool> emplace(Args&&... args);
+
+			bool empty() const noexcept;
+
+			const_iterator end() const noexcept;
+
+			iterator erase(const_iterator pos);
+			size_type erase(const Key& key);
+
+			const_iterator find(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> const_iterator find(const K& key) const;
+
+			std::pair<iterator, bool> insert(const Key& key);
+			std::pair<iterator, bool> insert(Key&& key);
+
+			const KeyContainer& keys() const noexcept;
+
+			const_iterator lower_bound(const Key& key) const;
+			template<typename K, typename C = Compare, typename = typename C::is_transparent> const_iterator lower_bound(const K& key) const;
+
+			void reserve(size_type count);
+
+			size_type size() const noexcept;
+
+			FlatSet& operator=(const FlatSet&) = default;
+			FlatSet& operator=(FlatSet&&) noexcept = default;
+
+		private:
+			template<typename K> size_type FindIndex(const K& key) const;
+			template<typename K> size_type LowerBoundIndex(const K& key) const;
+
+			Compare m_compare;
+			KeyContainer m_keys;
+	};
+
+	template<typename Key, std::size_t Capacity, typename Compare = std::less<>>
+	using FixedFlatSet = FlatSet<Key, FixedVector<Key, Capacity>, Compare>;
+
+	template<typename Key, std::size_t Capacity, typename Compare = std::less<>>
+	using HybridFlatSet = FlatSet<Key, HybridVector<Key, Capacity>, Compare>;
+}
+
+#include <NazaraUtils/FlatSet.inl>
+
+#endif // NAZARAUTILS_FLATSET_HPP
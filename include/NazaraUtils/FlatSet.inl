@@ -0,0 +1,197 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename Key, typename K, typename Compare>
+		std::size_t FlatLowerBound(const Key* keys, std::size_t keyCount, const K& key, const Compare& compare)
+		{
+			if (keyCount == 0)
+				return 0;
+
+			// Branchless binary search, the remaining range is halved each iteration using a conditional move
+			// (measured faster than a linear search even for 16 integer keys)
+			const Key* base = keys;
+			std::size_t length = keyCount;
+			while (length > 1)
+			{
+				std::size_t half = length / 2;
+				base = (compare(base[half], key)) ? base + half : base;
+				length -= half;
+			}
+
+			return static_cast<std::size_t>(base - keys) + compare(*base, key);
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class FlatSet
+	* \brief Sorted set of keys stored contiguously in a vector-like container
+	*
+	* Lookups are branchless binary searches, insertion and removal shift the following keys.
+	* FixedFlatSet and HybridFlatSet store their keys in a FixedVector and a HybridVector, small sets never allocate.
+	*
+	* \remark Heterogeneous lookup is available if Compare has an is_transparent member type (which is the case of the default std::less<>)
+	*/
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	FlatSet<Key, KeyContainer, Compare>::FlatSet(const Compare& compare) :
+	m_compare(compare)
+	{
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	FlatSet<Key, KeyContainer, Compare>::FlatSet(std::initializer_list<Key> keys, const Compare& compare) :
+	m_compare(compare)
+	{
+		reserve(keys.size());
+		for (const Key& key : keys)
+			insert(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::begin() const noexcept -> const_iterator
+	{
+		return m_keys.begin();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	void FlatSet<Key, KeyContainer, Compare>::clear() noexcept
+	{
+		m_keys.clear();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	bool FlatSet<Key, KeyContainer, Compare>::contains(const Key& key) const
+	{
+		return FindIndex(key) != m_keys.size();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename K, typename C, typename>
+	bool FlatSet<Key, KeyContainer, Compare>::contains(const K& key) const
+	{
+		return FindIndex(key) != m_keys.size();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename... Args>
+	auto FlatSet<Key, KeyContainer, Compare>::emplace(Args&&... args) -> std::pair<iterator, bool>
+	{
+		Key key(std::forward<Args>(args)...);
+
+		size_type index = LowerBoundIndex(key);
+		if (index != m_keys.size() && !m_compare(key, m_keys[index]))
+			return { m_keys.begin() + index, false };
+
+		m_keys.emplace(m_keys.begin() + index, std::move(key));
+		return { m_keys.begin() + index, true };
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	bool FlatSet<Key, KeyContainer, Compare>::empty() const noexcept
+	{
+		return m_keys.empty();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::end() const noexcept -> const_iterator
+	{
+		return m_keys.end();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::erase(const_iterator pos) -> iterator
+	{
+		return m_keys.erase(pos);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::erase(const Key& key) -> size_type
+	{
+		size_type index = FindIndex(key);
+		if (index == m_keys.size())
+			return 0;
+
+		m_keys.erase(m_keys.begin() + index);
+		return 1;
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::find(const Key& key) const -> const_iterator
+	{
+		return m_keys.begin() + FindIndex(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatSet<Key, KeyContainer, Compare>::find(const K& key) const -> const_iterator
+	{
+		return m_keys.begin() + FindIndex(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::insert(const Key& key) -> std::pair<iterator, bool>
+	{
+		return emplace(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::insert(Key&& key) -> std::pair<iterator, bool>
+	{
+		return emplace(std::move(key));
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	const KeyContainer& FlatSet<Key, KeyContainer, Compare>::keys() const noexcept
+	{
+		return m_keys;
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::lower_bound(const Key& key) const -> const_iterator
+	{
+		return m_keys.begin() + LowerBoundIndex(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename K, typename C, typename>
+	auto FlatSet<Key, KeyContainer, Compare>::lower_bound(const K& key) const -> const_iterator
+	{
+		return m_keys.begin() + LowerBoundIndex(key);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	void FlatSet<Key, KeyContainer, Compare>::reserve(size_type count)
+	{
+		m_keys.reserve(count);
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	auto FlatSet<Key, KeyContainer, Compare>::size() const noexcept -> size_type
+	{
+		return m_keys.size();
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename K>
+	auto FlatSet<Key, KeyContainer, Compare>::FindIndex(const K& key) const -> size_type
+	{
+		size_type index = LowerBoundIndex(key);
+		if (index != m_keys.size() && m_compare(key, m_keys[index]))
+			return m_keys.size();
+
+		return index;
+	}
+
+	template<typename Key, typename KeyContainer, typename Compare>
+	template<typename K>
+	auto FlatSet<Key, KeyContainer, Compare>::LowerBoundIndex(const K& key) const -> size_type
+	{
+		return Detail::FlatLowerBound(m_keys.data(), m_keys.size(), key, m_compare);
+	}
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_FRAMEALLOCATOR_HPP
+#define NAZARAUTILS_FRAMEALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/LinearArena.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	template<std::size_t FrameCount>
+	class FrameAllocator
+	{
+		static_assert(FrameCount > 0);
+
+		public:
+			explicit FrameAllocator(std::size_t blockSize);
+			FrameAllocator(const FrameAllocator&) = delete;
+			FrameAllocator(FrameAllocator&&) = delete;
+			~FrameAllocator() = default;
+
+			void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+			std::size_t GetBlockSize() const;
+			std::size_t GetCapacity() const;
+			UInt64 GetFrameIndex() const;
+			std::size_t GetThreadCount() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+			template<typename T> T* NewArray(std::size_t count);
+
+			void NextFrame();
+
+			FrameAllocator& operator=(const FrameAllocator&) = delete;
+			FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+		private:
+			struct ThreadArenas;
+
+			LinearArena& GetCurrentArena();
+			ThreadArenas& RegisterThread();
+
+			static UInt64 GenerateAllocatorId();
+
+			struct ThreadArenas
+			{
+				FixedVector<LinearArena, FrameCount> frameArenas;
+			};
+
+			struct ThreadCache
+			{
+				UInt64 allocatorId = 0;
+				ThreadArenas* threadArenas = nullptr;
+			};
+
+			mutable std::mutex m_threadMutex;
+			std::atomic<UInt64> m_frameIndex;
+			std::size_t m_blockSize;
+			std::unordered_map<std::thread::id, std::unique_ptr<ThreadArenas>> m_threadArenas;
+			UInt64 m_allocatorId;
+	};
+}
+
+#include <NazaraUtils/FrameAllocator.inl>
+
+#endif // NAZARAUTILS_FRAMEALLOCATOR_HPP
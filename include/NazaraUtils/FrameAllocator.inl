@@ -0,0 +1,184 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::FrameAllocator
+	* \brief Allocator rotating between FrameCount sets of linear arenas, for data whose lifetime spans a bounded number of frames
+	*
+	* Memory allocated during frame k stays valid until NextFrame is called for frame k + FrameCount, at which point it is reclaimed in bulk
+	* (and objects created with New/NewArray are destroyed), this makes it suitable for data consumed asynchronously by another thread with up to FrameCount - 1 frames of delay.
+	*
+	* Allocating is thread-safe: each thread allocates from its own arenas, which are created the first time it allocates.
+	*
+	* \remark NextFrame must not be called while other threads are allocating
+	*/
+
+	/*!
+	* \brief Constructs a FrameAllocator object
+	*
+	* \param blockSize Size of blocks of the per-thread arenas
+	*/
+	template<std::size_t FrameCount>
+	FrameAllocator<FrameCount>::FrameAllocator(std::size_t blockSize) :
+	m_frameIndex(0),
+	m_blockSize(blockSize),
+	m_allocatorId(GenerateAllocatorId())
+	{
+	}
+
+	/*!
+	* \brief Allocates raw memory for the current frame
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the allocation in bytes
+	* \param alignment Power of two alignment of the allocation
+	*/
+	template<std::size_t FrameCount>
+	void* FrameAllocator<FrameCount>::Allocate(std::size_t size, std::size_t alignment)
+	{
+		return GetCurrentArena().Allocate(size, alignment);
+	}
+
+	/*!
+	* \brief Gets the block size of per-thread arenas
+	* \return Block size in bytes
+	*/
+	template<std::size_t FrameCount>
+	std::size_t FrameAllocator<FrameCount>::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the total capacity of all arenas
+	* \return Sum of the capacity of every arena of every thread, for every frame
+	*/
+	template<std::size_t FrameCount>
+	std::size_t FrameAllocator<FrameCount>::GetCapacity() const
+	{
+		std::lock_guard lock(m_threadMutex);
+
+		std::size_t capacity = 0;
+		for (auto&& [threadId, threadArenas] : m_threadArenas)
+		{
+			for (const LinearArena& arena : threadArenas->frameArenas)
+				capacity += arena.GetCapacity();
+		}
+
+		return capacity;
+	}
+
+	/*!
+	* \brief Gets the current frame index
+	* \return Number of times NextFrame has been called
+	*/
+	template<std::size_t FrameCount>
+	UInt64 FrameAllocator<FrameCount>::GetFrameIndex() const
+	{
+		return m_frameIndex.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the number of threads which allocated from this allocator
+	* \return Thread count
+	*/
+	template<std::size_t FrameCount>
+	std::size_t FrameAllocator<FrameCount>::GetThreadCount() const
+	{
+		std::lock_guard lock(m_threadMutex);
+		return m_threadArenas.size();
+	}
+
+	/*!
+	* \brief Allocates and constructs an object for the current frame
+	* \return Pointer to the constructed object
+	*
+	* \param args Arguments to forward to the constructor
+	*
+	* \remark The object destructor will be called when its frame memory is reclaimed, if it's not trivially destructible
+	*/
+	template<std::size_t FrameCount>
+	template<typename T, typename... Args>
+	T* FrameAllocator<FrameCount>::New(Args&&... args)
+	{
+		return GetCurrentArena().template New<T>(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Allocates and value-initializes an array of objects for the current frame
+	* \return Pointer to the first object of the array
+	*
+	* \param count Number of objects
+	*
+	* \remark The objects destructors will be called when their frame memory is reclaimed, if they're not trivially destructible
+	*/
+	template<std::size_t FrameCount>
+	template<typename T>
+	T* FrameAllocator<FrameCount>::NewArray(std::size_t count)
+	{
+		return GetCurrentArena().template NewArray<T>(count);
+	}
+
+	/*!
+	* \brief Begins a new frame, reclaiming the memory allocated FrameCount frames ago
+	*
+	* \remark This must not be called concurrently with allocations
+	*/
+	template<std::size_t FrameCount>
+	void FrameAllocator<FrameCount>::NextFrame()
+	{
+		UInt64 frameIndex = m_frameIndex.load(std::memory_order_relaxed) + 1;
+		std::size_t arenaIndex = static_cast<std::size_t>(frameIndex % FrameCount);
+
+		std::lock_guard lock(m_threadMutex);
+		for (auto&& [threadId, threadArenas] : m_threadArenas)
+			threadArenas->frameArenas[arenaIndex].Reset();
+
+		m_frameIndex.store(frameIndex, std::memory_order_release);
+	}
+
+	template<std::size_t FrameCount>
+	LinearArena& FrameAllocator<FrameCount>::GetCurrentArena()
+	{
+		// Most of the time a thread allocates from the same allocator, cache its arenas to avoid locking
+		thread_local ThreadCache threadCache;
+		if (threadCache.allocatorId != m_allocatorId)
+		{
+			threadCache.allocatorId = m_allocatorId;
+			threadCache.threadArenas = &RegisterThread();
+		}
+
+		std::size_t arenaIndex = static_cast<std::size_t>(m_frameIndex.load(std::memory_order_acquire) % FrameCount);
+		return threadCache.threadArenas->frameArenas[arenaIndex];
+	}
+
+	template<std::size_t FrameCount>
+	auto FrameAllocator<FrameCount>::RegisterThread() -> ThreadArenas&
+	{
+		std::lock_guard lock(m_threadMutex);
+
+		auto& threadArenas = m_threadArenas[std::this_thread::get_id()];
+		if (!threadArenas)
+		{
+			threadArenas = std::make_unique<ThreadArenas>();
+			for (std::size_t i = 0; i < FrameCount; ++i)
+				threadArenas->frameArenas.emplace_back(m_blockSize);
+		}
+
+		return *threadArenas;
+	}
+
+	template<std::size_t FrameCount>
+	UInt64 FrameAllocator<FrameCount>::GenerateAllocatorId()
+	{
+		// Identifiers are never reused so that thread caches can't refer to a destroyed allocator
+		static std::atomic<UInt64> s_allocatorCounter(0);
+		return ++s_allocatorCounter;
+	}
+}
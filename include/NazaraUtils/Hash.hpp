@@ -32,6 +32,17 @@ namespace Nz
 		template<typename... Args> UInt32 operator()(Args&&... args);
 	};
 
+	// Cyclic Redundancy Check (CRC) - 32bits, Castagnoli polynomial
+	constexpr UInt32 CRC32C(const char* str) noexcept;
+	constexpr UInt32 CRC32C(std::string_view str) noexcept;
+	constexpr UInt32 CRC32C(const UInt8* data, std::size_t size) noexcept;
+	template<std::size_t N> constexpr UInt32 CRC32C(const char(&str)[N]) noexcept;
+
+	struct CRC32CHash
+	{
+		template<typename... Args> UInt32 operator()(Args&&... args);
+	};
+
 	// Fowler–Noll–Vo (FNV) 1a - 32bits
 	constexpr UInt32 FNV1a32(const char* str) noexcept;
 	constexpr UInt32 FNV1a32(std::string_view str) noexcept;
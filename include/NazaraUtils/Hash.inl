@@ -2,7 +2,29 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <NazaraUtils/ConstantEvaluated.hpp>
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+	#if defined(NAZARA_COMPILER_MSVC)
+		#include <intrin.h>
+		#define NAZARA_UTILS_CRC32_X86
+		#define NAZARA_UTILS_CRC32_TARGET(Features)
+	#elif defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+		#include <cpuid.h>
+		#include <nmmintrin.h> //< SSE4.2 (and SSE4.1), lighter than immintrin.h
+		#include <wmmintrin.h> //< PCLMULQDQ
+		#define NAZARA_UTILS_CRC32_X86
+		#define NAZARA_UTILS_CRC32_TARGET(Features) __attribute__((target(Features)))
+	#endif
+#elif defined(NAZARA_ARCH_aarch64) && defined(__ARM_FEATURE_CRC32)
+	#include <arm_acle.h>
+	#define NAZARA_UTILS_CRC32_ARM
+	#define NAZARA_UTILS_CRC32_TARGET(Features)
+#endif
 
 namespace Nz
 {
@@ -47,6 +69,395 @@ NAZARA_WARNING_POP()
 			"GenerateCRC32Table generated unexpected result."
 		);
 
+		// Stores CRC-32C table (used for constant evaluation)
+		static constexpr auto s_crc32cTable = GenerateCRC32Table(0x82F63B78);
+
+		// Generates the tables of the slicing-by-N algorithm, table[k][byte] being the CRC of byte followed by k zero bytes
+		// This is not constexpr on purpose, see GetCRC32SlicingTables
+		template<std::size_t SliceCount>
+		auto GenerateCRC32SlicingTables(UInt32 polynomial)
+		{
+			std::array<std::array<UInt32, 256>, SliceCount> tables{};
+			tables[0] = GenerateCRC32Table(polynomial);
+			for (std::size_t slice = 1; slice < SliceCount; ++slice)
+			{
+				for (std::size_t byte = 0; byte < 256; ++byte)
+				{
+					UInt32 crc = tables[slice - 1][byte];
+					tables[slice][byte] = (crc >> 8) ^ tables[0][crc & 0xFF];
+				}
+			}
+
+			return tables;
+		}
+
+		using CRC32SlicingTables = std::array<std::array<UInt32, 256>, 16>;
+
+		// Slicing tables are generated at runtime on first use, generating them at compile-time would slow down every translation unit including this header
+		template<UInt32 Polynomial>
+		const CRC32SlicingTables& GetCRC32SlicingTables()
+		{
+			static const CRC32SlicingTables tables = GenerateCRC32SlicingTables<16>(Polynomial);
+			return tables;
+		}
+
+		template<typename T>
+		constexpr UInt32 LoadLittleEndian32(const T* data)
+		{
+			return UInt32(static_cast<UInt8>(data[0])) | (UInt32(static_cast<UInt8>(data[1])) << 8) | (UInt32(static_cast<UInt8>(data[2])) << 16) | (UInt32(static_cast<UInt8>(data[3])) << 24);
+		}
+
+		template<typename T>
+		constexpr UInt32 UpdateCRC32Bytewise(UInt32 crc, const T* data, std::size_t size, const std::array<UInt32, 256>& table) noexcept
+		{
+			for (std::size_t i = 0; i < size; ++i)
+				crc = table[(crc ^ static_cast<UInt8>(data[i])) & 0xFF] ^ (crc >> 8);
+
+			return crc;
+		}
+
+		// Slicing-by-16: processes 16 bytes per iteration with 16 independent table lookups
+		template<typename T>
+		UInt32 UpdateCRC32Slicing(UInt32 crc, const T* data, std::size_t size, const CRC32SlicingTables& tables) noexcept
+		{
+			while (size >= 16)
+			{
+				UInt32 word0 = crc ^ LoadLittleEndian32(data);
+				UInt32 word1 = LoadLittleEndian32(data + 4);
+				UInt32 word2 = LoadLittleEndian32(data + 8);
+				UInt32 word3 = LoadLittleEndian32(data + 12);
+
+				crc = tables[15][word0 & 0xFF] ^ tables[14][(word0 >> 8) & 0xFF] ^ tables[13][(word0 >> 16) & 0xFF] ^ tables[12][word0 >> 24] ^
+				      tables[11][word1 & 0xFF] ^ tables[10][(word1 >> 8) & 0xFF] ^ tables[9][(word1 >> 16) & 0xFF] ^ tables[8][word1 >> 24] ^
+				      tables[7][word2 & 0xFF] ^ tables[6][(word2 >> 8) & 0xFF] ^ tables[5][(word2 >> 16) & 0xFF] ^ tables[4][word2 >> 24] ^
+				      tables[3][word3 & 0xFF] ^ tables[2][(word3 >> 8) & 0xFF] ^ tables[1][(word3 >> 16) & 0xFF] ^ tables[0][word3 >> 24];
+
+				data += 16;
+				size -= 16;
+			}
+
+			return UpdateCRC32Bytewise(crc, data, size, tables[0]);
+		}
+
+#ifdef NAZARA_UTILS_CRC32_X86
+		struct X86CRCFeatures
+		{
+			bool pclmul = false;
+			bool sse41 = false;
+			bool sse42 = false;
+		};
+
+		inline const X86CRCFeatures& GetX86CRCFeatures()
+		{
+			static const X86CRCFeatures features = []
+			{
+				unsigned int ecx;
+#ifdef NAZARA_COMPILER_MSVC
+				int cpuInfo[4];
+				__cpuid(cpuInfo, 1);
+				ecx = static_cast<unsigned int>(cpuInfo[2]);
+#else
+				unsigned int eax, ebx, edx;
+				if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+					return X86CRCFeatures{};
+#endif
+
+				X86CRCFeatures cpuFeatures;
+				cpuFeatures.pclmul = (ecx & (1u << 1)) != 0;
+				cpuFeatures.sse41 = (ecx & (1u << 19)) != 0;
+				cpuFeatures.sse42 = (ecx & (1u << 20)) != 0;
+
+				return cpuFeatures;
+			}();
+
+			return features;
+		}
+
+		// CRC-32 folding using carry-less multiplications, from Intel "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+		// (constants are those of the reflected 0xEDB88320 polynomial), size must be a multiple of 16 and at least 64
+		NAZARA_UTILS_CRC32_TARGET("pclmul,sse4.1")
+		inline UInt32 UpdateCRC32PCLMUL(UInt32 crc, const UInt8* data, std::size_t size) noexcept
+		{
+			__m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+			__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+			__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+			__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+
+			x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+			data += 64;
+			size -= 64;
+
+			// Fold 64 bytes at a time
+			__m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+			while (size >= 64)
+			{
+				__m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+				__m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+				__m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+				__m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+				x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+				x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+				x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+				x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+				x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+				x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+				x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+
+				data += 64;
+				size -= 64;
+			}
+
+			// Fold the four accumulators into one
+			__m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+			for (__m128i next : { x2, x3, x4 })
+			{
+				__m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+				x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, next), x5);
+			}
+
+			// Fold remaining 16 bytes blocks
+			while (size >= 16)
+			{
+				__m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+				x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data))), x5);
+
+				data += 16;
+				size -= 16;
+			}
+
+			// Fold 128 bits to 64 bits
+			__m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+			__m128i x2Fold = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2Fold);
+
+			__m128i k5k0 = _mm_set_epi64x(0, 0x0163CD6124);
+			x2Fold = _mm_srli_si128(x1, 4);
+			x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00);
+			x1 = _mm_xor_si128(x1, x2Fold);
+
+			// Barrett reduction to 32 bits
+			__m128i poly = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+			x2Fold = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+			x2Fold = _mm_clmulepi64_si128(_mm_and_si128(x2Fold, mask32), poly, 0x00);
+			x1 = _mm_xor_si128(x1, x2Fold);
+
+			return static_cast<UInt32>(_mm_extract_epi32(x1, 1));
+		}
+#endif
+
+#ifdef NAZARA_UTILS_CRC32_ARM
+		inline UInt32 UpdateCRC32ARM(UInt32 crc, const UInt8* data, std::size_t size) noexcept
+		{
+			for (; size >= 8; size -= 8, data += 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(value));
+				crc = __crc32d(crc, value);
+			}
+
+			for (; size > 0; --size)
+				crc = __crc32b(crc, *data++);
+
+			return crc;
+		}
+#endif
+
+		// Operators appending N zero bytes to a CRC-32C (as 4 tables of 256 entries, one per byte of the CRC)
+		// This allows to combine CRCs computed in parallel, from Mark Adler's crc32c.c
+		using CRC32CShiftTables = std::array<std::array<UInt32, 256>, 4>;
+		using GF2Matrix = std::array<UInt32, 32>;
+
+		constexpr UInt32 MultiplyGF2Matrix(const GF2Matrix& matrix, UInt32 vector)
+		{
+			UInt32 sum = 0;
+			for (std::size_t i = 0; vector != 0; ++i, vector >>= 1)
+			{
+				if (vector & 1)
+					sum ^= matrix[i];
+			}
+
+			return sum;
+		}
+
+		// This is not constexpr on purpose, see GetCRC32CShiftTables
+		template<std::size_t ByteCount>
+		CRC32CShiftTables GenerateCRC32CShiftTables()
+		{
+			static_assert(ByteCount > 0 && (ByteCount & (ByteCount - 1)) == 0, "byte count must be a power of two");
+
+			// Operator for one zero bit
+			GF2Matrix op{};
+			op[0] = 0x82F63B78;
+			for (std::size_t i = 1; i < 32; ++i)
+				op[i] = UInt32(1) << (i - 1);
+
+			// Squaring the operator doubles the number of zero bits
+			for (std::size_t bitCount = 1; bitCount < ByteCount * 8; bitCount *= 2)
+			{
+				GF2Matrix square{};
+				for (std::size_t i = 0; i < 32; ++i)
+					square[i] = MultiplyGF2Matrix(op, op[i]);
+
+				op = square;
+			}
+
+			CRC32CShiftTables tables{};
+			for (UInt32 byte = 0; byte < 256; ++byte)
+			{
+				for (std::size_t i = 0; i < 4; ++i)
+					tables[i][byte] = MultiplyGF2Matrix(op, byte << (i * 8));
+			}
+
+			return tables;
+		}
+
+		constexpr std::size_t CRC32CLongBlockSize = 8192;
+		constexpr std::size_t CRC32CShortBlockSize = 256;
+
+		// Like slicing tables, shift tables are generated at runtime on first use to keep compilation fast
+		template<std::size_t ByteCount>
+		const CRC32CShiftTables& GetCRC32CShiftTables()
+		{
+			static const CRC32CShiftTables tables = GenerateCRC32CShiftTables<ByteCount>();
+			return tables;
+		}
+
+		constexpr UInt32 ShiftCRC32C(const CRC32CShiftTables& shiftTables, UInt32 crc)
+		{
+			return shiftTables[0][crc & 0xFF] ^ shiftTables[1][(crc >> 8) & 0xFF] ^ shiftTables[2][(crc >> 16) & 0xFF] ^ shiftTables[3][crc >> 24];
+		}
+
+#if defined(NAZARA_UTILS_CRC32_X86) || defined(NAZARA_UTILS_CRC32_ARM)
+		NAZARA_UTILS_CRC32_TARGET("sse4.2")
+		inline UInt32 UpdateCRC32CHardware(UInt32 crc, UInt8 byte) noexcept
+		{
+#ifdef NAZARA_UTILS_CRC32_X86
+			return _mm_crc32_u8(crc, byte);
+#else
+			return __crc32cb(crc, byte);
+#endif
+		}
+
+		NAZARA_UTILS_CRC32_TARGET("sse4.2")
+		inline UInt32 UpdateCRC32CHardware(UInt32 crc, const UInt8* data) noexcept
+		{
+			UInt64 value;
+			std::memcpy(&value, data, sizeof(value));
+
+#if defined(NAZARA_UTILS_CRC32_ARM)
+			return __crc32cd(crc, value);
+#elif defined(NAZARA_ARCH_x86_64)
+			return static_cast<UInt32>(_mm_crc32_u64(crc, value));
+#else
+			crc = _mm_crc32_u32(crc, static_cast<UInt32>(value));
+			return _mm_crc32_u32(crc, static_cast<UInt32>(value >> 32));
+#endif
+		}
+
+		// Processes blocks of 3 * blockSize bytes as three independent streams to hide the latency of CRC32C instructions
+		NAZARA_UTILS_CRC32_TARGET("sse4.2")
+		inline UInt32 UpdateCRC32CHardwareBlocks(UInt32 crc, const UInt8*& data, std::size_t& size, std::size_t blockSize, const CRC32CShiftTables& shiftTables) noexcept
+		{
+			while (size >= blockSize * 3)
+			{
+				UInt32 crc1 = 0;
+				UInt32 crc2 = 0;
+				for (const UInt8* end = data + blockSize; data < end; data += 8)
+				{
+					crc = UpdateCRC32CHardware(crc, data);
+					crc1 = UpdateCRC32CHardware(crc1, data + blockSize);
+					crc2 = UpdateCRC32CHardware(crc2, data + blockSize * 2);
+				}
+
+				crc = ShiftCRC32C(shiftTables, crc) ^ crc1;
+				crc = ShiftCRC32C(shiftTables, crc) ^ crc2;
+
+				data += blockSize * 2;
+				size -= blockSize * 3;
+			}
+
+			return crc;
+		}
+
+		// Computes a CRC-32C using the SSE4.2/ARMv8 CRC32C instructions
+		NAZARA_UTILS_CRC32_TARGET("sse4.2")
+		inline UInt32 UpdateCRC32CHardware(UInt32 crc, const UInt8* data, std::size_t size) noexcept
+		{
+			// Align data on 8 bytes
+			for (; size > 0 && (reinterpret_cast<std::uintptr_t>(data) & 7) != 0; --size)
+				crc = UpdateCRC32CHardware(crc, *data++);
+
+			if (size >= CRC32CShortBlockSize * 3)
+			{
+				crc = UpdateCRC32CHardwareBlocks(crc, data, size, CRC32CLongBlockSize, GetCRC32CShiftTables<CRC32CLongBlockSize>());
+				crc = UpdateCRC32CHardwareBlocks(crc, data, size, CRC32CShortBlockSize, GetCRC32CShiftTables<CRC32CShortBlockSize>());
+			}
+
+			for (; size >= 8; size -= 8, data += 8)
+				crc = UpdateCRC32CHardware(crc, data);
+
+			for (; size > 0; --size)
+				crc = UpdateCRC32CHardware(crc, *data++);
+
+			return crc;
+		}
+#endif
+
+		// Updates a CRC-32C (without initial and final inversions), using hardware acceleration when available at runtime
+		template<typename T>
+		constexpr UInt32 UpdateCRC32C(UInt32 crc, const T* data, std::size_t size) noexcept
+		{
+#ifdef NAZARA_HAS_CONSTEVAL
+			if NAZARA_IS_RUNTIME_EVAL()
+			{
+#if defined(NAZARA_UTILS_CRC32_X86)
+				if (GetX86CRCFeatures().sse42)
+					return UpdateCRC32CHardware(crc, reinterpret_cast<const UInt8*>(data), size);
+#elif defined(NAZARA_UTILS_CRC32_ARM)
+				return UpdateCRC32CHardware(crc, reinterpret_cast<const UInt8*>(data), size);
+#endif
+
+				return UpdateCRC32Slicing(crc, data, size, GetCRC32SlicingTables<0x82F63B78>());
+			}
+#endif
+
+			return UpdateCRC32Bytewise(crc, data, size, s_crc32cTable);
+		}
+
+		// Updates a CRC-32 (without initial and final inversions), using hardware acceleration when available at runtime
+		template<typename T>
+		constexpr UInt32 UpdateCRC32(UInt32 crc, const T* data, std::size_t size) noexcept
+		{
+#ifdef NAZARA_HAS_CONSTEVAL
+			if NAZARA_IS_RUNTIME_EVAL()
+			{
+#if defined(NAZARA_UTILS_CRC32_X86)
+				const X86CRCFeatures& cpuFeatures = GetX86CRCFeatures();
+				if (size >= 64 && cpuFeatures.pclmul && cpuFeatures.sse41)
+				{
+					std::size_t blockSize = size & ~std::size_t(15);
+					crc = UpdateCRC32PCLMUL(crc, reinterpret_cast<const UInt8*>(data), blockSize);
+
+					data += blockSize;
+					size -= blockSize;
+				}
+#elif defined(NAZARA_UTILS_CRC32_ARM)
+				return UpdateCRC32ARM(crc, reinterpret_cast<const UInt8*>(data), size);
+#endif
+
+				return UpdateCRC32Slicing(crc, data, size, GetCRC32SlicingTables<0xEDB88320>());
+			}
+#endif
+
+			return UpdateCRC32Bytewise(crc, data, size, s_crc32Table);
+		}
+
 		constexpr UInt32 FNV1OffsetBasis_32 = 0x811c9dc5u;
 		constexpr UInt32 FNV1Prime_32 = 0x1000193u;
 
@@ -97,35 +508,19 @@ NAZARA_WARNING_POP()
 	}
 
 
-	// From https://stackoverflow.com/questions/28675727/using-crc32-algorithm-to-hash-string-at-compile-time
 	constexpr UInt32 CRC32(const char* str) noexcept
 	{
-		UInt32 crc = 0xFFFFFFFFu;
-
-		for (std::size_t i = 0u; str[i]; ++i)
-			crc = Detail::s_crc32Table[(crc ^ str[i]) & 0xFF] ^ (crc >> 8);
-
-		return ~crc;
+		return CRC32(std::string_view(str));
 	}
 
 	constexpr UInt32 CRC32(std::string_view str) noexcept
 	{
-		UInt32 crc = 0xFFFFFFFFu;
-
-		for (std::size_t i = 0u; i < str.size(); ++i)
-			crc = Detail::s_crc32Table[(crc ^ str[i]) & 0xFF] ^ (crc >> 8);
-
-		return ~crc;
+		return ~Detail::UpdateCRC32(0xFFFFFFFFu, str.data(), str.size());
 	}
 
 	constexpr UInt32 CRC32(const UInt8* input, std::size_t size) noexcept
 	{
-		UInt32 crc = 0xFFFFFFFFu;
-
-		for (std::size_t i = 0u; i < size; ++i)
-			crc = Detail::s_crc32Table[(crc ^ input[i]) & 0xFF] ^ (crc >> 8);
-
-		return ~crc;
+		return ~Detail::UpdateCRC32(0xFFFFFFFFu, input, size);
 	}
 
 	template<std::size_t N>
@@ -141,6 +536,34 @@ NAZARA_WARNING_POP()
 	}
 
 
+	constexpr UInt32 CRC32C(const char* str) noexcept
+	{
+		return CRC32C(std::string_view(str));
+	}
+
+	constexpr UInt32 CRC32C(std::string_view str) noexcept
+	{
+		return ~Detail::UpdateCRC32C(0xFFFFFFFFu, str.data(), str.size());
+	}
+
+	constexpr UInt32 CRC32C(const UInt8* input, std::size_t size) noexcept
+	{
+		return ~Detail::UpdateCRC32C(0xFFFFFFFFu, input, size);
+	}
+
+	template<std::size_t N>
+	constexpr UInt32 CRC32C(const char(&str)[N]) noexcept
+	{
+		return CRC32C(std::string_view(str, N));
+	}
+
+	template<typename... Args>
+	UInt32 CRC32CHash::operator()(Args&&... args)
+	{
+		return CRC32C(std::forward<Args>(args)...);
+	}
+
+
 	constexpr UInt32 FNV1a32(const char* str) noexcept
 	{
 		UInt32 hash = Detail::FNV1OffsetBasis_32;
@@ -245,3 +668,6 @@ NAZARA_WARNING_POP()
 	}
 }
 
+#undef NAZARA_UTILS_CRC32_ARM
+#undef NAZARA_UTILS_CRC32_X86
+#undef NAZARA_UTILS_CRC32_TARGET
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_INPLACEFUNCTION_HPP
+#define NAZARAUTILS_INPLACEFUNCTION_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity = 4 * sizeof(void*)>
+	class InplaceFunction;
+
+	namespace Detail
+	{
+		// Callables which can be empty (and are stored as an empty InplaceFunction)
+		template<typename F>
+		struct IsNullableCallable : std::bool_constant<std::is_pointer_v<F> || std::is_member_pointer_v<F>> {};
+
+		template<typename Sig>
+		struct IsNullableCallable<std::function<Sig>> : std::true_type {};
+
+		template<typename Sig, std::size_t Capacity>
+		struct IsNullableCallable<InplaceFunction<Sig, Capacity>> : std::true_type {};
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	class InplaceFunction<Ret(Args...), Capacity>
+	{
+		public:
+			InplaceFunction() noexcept;
+			InplaceFunction(std::nullptr_t) noexcept;
+			template<typename F, typename = std::enable_if_t<std::is_invocable_r_v<Ret, std::decay_t<F>&, Args...> && !std::is_same_v<std::decay_t<F>, InplaceFunction>>> InplaceFunction(F&& f);
+			InplaceFunction(const InplaceFunction&) = delete;
+			InplaceFunction(InplaceFunction&& function) noexcept;
+			~InplaceFunction();
+
+			void Reset();
+
+			Ret operator()(Args... args);
+
+			explicit operator bool() const;
+
+			InplaceFunction& operator=(const InplaceFunction&) = delete;
+			InplaceFunction& operator=(InplaceFunction&& function) noexcept;
+			InplaceFunction& operator=(std::nullptr_t);
+
+			static constexpr std::size_t StorageCapacity = Capacity;
+
+		private:
+			struct Operations
+			{
+				Ret(*invoke)(void* functor, Args&&... args);
+				void(*relocate)(void* destination, void* source);
+				void(*destroy)(void* functor);
+			};
+
+			template<typename F> static const Operations s_operations;
+
+			const Operations* m_operations;
+			alignas(std::max_align_t) std::array<std::byte, Capacity> m_storage;
+	};
+}
+
+#include <NazaraUtils/InplaceFunction.inl>
+
+#endif // NAZARAUTILS_INPLACEFUNCTION_HPP
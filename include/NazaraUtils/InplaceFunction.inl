@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class InplaceFunction
+	* \brief Move-only function wrapper storing its callable in an inline buffer, it never allocates
+	*
+	* Callables bigger than Capacity (or over-aligned) are rejected at compile-time.
+	* Null function pointers and empty function objects (std::function, InplaceFunction) give an empty InplaceFunction.
+	*/
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F>
+	const typename InplaceFunction<Ret(Args...), Capacity>::Operations InplaceFunction<Ret(Args...), Capacity>::s_operations = {
+		[](void* functor, Args&&... args) -> Ret
+		{
+			// Return value of the callable is discarded for void functions
+			if constexpr (std::is_void_v<Ret>)
+				std::invoke(*static_cast<F*>(functor), std::forward<Args>(args)...);
+			else
+				return std::invoke(*static_cast<F*>(functor), std::forward<Args>(args)...);
+		},
+		[](void* destination, void* source)
+		{
+			F* sourceFunctor = static_cast<F*>(source);
+			PlacementNew(static_cast<F*>(destination), std::move(*sourceFunctor));
+			PlacementDestroy(sourceFunctor);
+		},
+		[](void* functor)
+		{
+			PlacementDestroy(static_cast<F*>(functor));
+		}
+	};
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction() noexcept :
+	m_operations(nullptr)
+	{
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(std::nullptr_t) noexcept :
+	m_operations(nullptr)
+	{
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	template<typename F, typename>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(F&& f) :
+	m_operations(nullptr)
+	{
+		using Functor = std::decay_t<F>;
+		static_assert(sizeof(Functor) <= Capacity, "functor is too big for this InplaceFunction capacity");
+		static_assert(alignof(Functor) <= alignof(std::max_align_t), "over-aligned functors are not supported");
+		static_assert(std::is_nothrow_move_constructible_v<Functor>, "functor must be nothrow move constructible");
+
+		// Function references decay to pointers but are never null
+		if constexpr (Detail::IsNullableCallable<std::remove_cv_t<std::remove_reference_t<F>>>::value)
+		{
+			if (!f)
+				return;
+		}
+
+		PlacementNew(reinterpret_cast<Functor*>(m_storage.data()), std::forward<F>(f));
+		m_operations = &s_operations<Functor>;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(InplaceFunction&& function) noexcept :
+	m_operations(function.m_operations)
+	{
+		if (m_operations)
+		{
+			m_operations->relocate(m_storage.data(), function.m_storage.data());
+			function.m_operations = nullptr;
+		}
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::~InplaceFunction()
+	{
+		Reset();
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	void InplaceFunction<Ret(Args...), Capacity>::Reset()
+	{
+		if (m_operations)
+		{
+			m_operations->destroy(m_storage.data());
+			m_operations = nullptr;
+		}
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	Ret InplaceFunction<Ret(Args...), Capacity>::operator()(Args... args)
+	{
+		NazaraAssertMsg(m_operations, "calling an empty InplaceFunction");
+		return m_operations->invoke(m_storage.data(), std::forward<Args>(args)...);
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	InplaceFunction<Ret(Args...), Capacity>::operator bool() const
+	{
+		return m_operations != nullptr;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto InplaceFunction<Ret(Args...), Capacity>::operator=(InplaceFunction&& function) noexcept -> InplaceFunction&
+	{
+		if (this == &function)
+			return *this;
+
+		Reset();
+		if (function.m_operations)
+		{
+			m_operations = std::exchange(function.m_operations, nullptr);
+			m_operations->relocate(m_storage.data(), function.m_storage.data());
+		}
+
+		return *this;
+	}
+
+	template<typename Ret, typename... Args, std::size_t Capacity>
+	auto InplaceFunction<Ret(Args...), Capacity>::operator=(std::nullptr_t) -> InplaceFunction&
+	{
+		Reset();
+		return *this;
+	}
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_LINEARARENA_HPP
+#define NAZARAUTILS_LINEARARENA_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MovablePtr.hpp>
+#include <NazaraUtils/MovableValue.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class LinearArena
+	{
+		struct DestructorNode;
+
+		public:
+			class Marker;
+			class RewindScope;
+
+			explicit LinearArena(std::size_t blockSize);
+			LinearArena(const LinearArena&) = delete;
+			LinearArena(LinearArena&&) noexcept = default;
+			~LinearArena();
+
+			void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+			void Clear();
+
+			std::size_t GetBlockCount() const;
+			std::size_t GetBlockSize() const;
+			std::size_t GetCapacity() const;
+			Marker GetMarker() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+			template<typename T> T* NewArray(std::size_t count);
+
+			void Reset();
+			void Rewind(const Marker& marker);
+
+			LinearArena& operator=(const LinearArena&) = delete;
+			LinearArena& operator=(LinearArena&& arena) noexcept;
+
+		private:
+			void AllocateBlock(std::size_t size);
+			void RegisterDestructor(DestructorNode* node, void* object, std::size_t count, void(*destructor)(void*, std::size_t));
+
+			struct Block
+			{
+				std::unique_ptr<std::byte[]> memory;
+				std::size_t size;
+			};
+
+			struct DestructorNode
+			{
+				void(*destructor)(void* object, std::size_t count);
+				void* object;
+				std::size_t count;
+				DestructorNode* previous;
+			};
+
+			std::size_t m_blockSize;
+			std::vector<Block> m_blocks;
+			MovableLiteral<std::size_t, 0> m_currentBlock;
+			MovableLiteral<std::size_t, 0> m_currentOffset;
+			MovablePtr<DestructorNode> m_destructorHead;
+	};
+
+	class LinearArena::Marker
+	{
+		friend LinearArena;
+
+		public:
+			Marker() = default;
+			Marker(const Marker&) = default;
+			~Marker() = default;
+
+			Marker& operator=(const Marker&) = default;
+
+		private:
+			std::size_t m_blockIndex = 0;
+			std::size_t m_offset = 0;
+			DestructorNode* m_destructorHead = nullptr;
+	};
+
+	class LinearArena::RewindScope
+	{
+		public:
+			explicit RewindScope(LinearArena& arena);
+			RewindScope(const RewindScope&) = delete;
+			RewindScope(RewindScope&&) = delete;
+			~RewindScope();
+
+			RewindScope& operator=(const RewindScope&) = delete;
+			RewindScope& operator=(RewindScope&&) = delete;
+
+		private:
+			LinearArena& m_arena;
+			Marker m_marker;
+	};
+}
+
+#include <NazaraUtils/LinearArena.inl>
+
+#endif // NAZARAUTILS_LINEARARENA_HPP
@@ -0,0 +1,300 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::LinearArena
+	* \brief Bump allocator for variable-size allocations sharing the same lifetime
+	*
+	* Allocating is only a matter of aligning and moving forward an offset in the current block, blocks being chained as needed.
+	* Memory is never released individually but in bulk, either entirely (Reset/Clear) or up to a marker (Rewind).
+	* Objects created with New/NewArray have their destructor called on release if they're not trivially destructible.
+	*/
+
+	/*!
+	* \brief Constructs a LinearArena object
+	*
+	* \param blockSize Size of blocks that will be allocated (in bytes), allocations bigger than this get their own block
+	*/
+	inline LinearArena::LinearArena(std::size_t blockSize) :
+	m_blockSize(blockSize)
+	{
+		assert(blockSize > 0);
+
+		// Allocate one block by default
+		AllocateBlock(m_blockSize);
+	}
+
+	/*!
+	* \brief Destroys the arena, calling the destructor of every tracked object and releasing blocks
+	*/
+	inline LinearArena::~LinearArena()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Allocates raw memory from the arena
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the allocation in bytes
+	* \param alignment Power of two alignment of the allocation
+	*/
+	inline void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		assert(alignment > 0 && IsPow2(alignment));
+
+		for (; m_currentBlock < m_blocks.size(); m_currentBlock.Get()++, m_currentOffset = 0)
+		{
+			Block& block = m_blocks[m_currentBlock];
+
+			std::uintptr_t baseAddress = PointerToInteger<std::uintptr_t>(block.memory.get());
+			std::size_t offset = AlignPow2<std::uintptr_t>(baseAddress + m_currentOffset, alignment) - baseAddress;
+			if (offset + size <= block.size)
+			{
+				m_currentOffset = offset + size;
+				return &block.memory[offset];
+			}
+		}
+
+		// No more room, allocate a new block (big enough to hold this allocation whatever the block memory alignment)
+		AllocateBlock(std::max(m_blockSize, size + alignment - 1));
+		m_currentBlock = m_blocks.size() - 1;
+		m_currentOffset = 0;
+
+		return Allocate(size, alignment);
+	}
+
+	/*!
+	* \brief Resets the arena and releases every block
+	*
+	* \see Reset
+	*/
+	inline void LinearArena::Clear()
+	{
+		Reset();
+
+		m_blocks.clear();
+	}
+
+	/*!
+	* \brief Gets the block count
+	* \return How many blocks are currently allocated for this arena
+	*/
+	inline std::size_t LinearArena::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the default block size
+	* \return Size of regular blocks in bytes
+	*/
+	inline std::size_t LinearArena::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the capacity of the arena
+	* \return Total size of all allocated blocks in bytes
+	*/
+	inline std::size_t LinearArena::GetCapacity() const
+	{
+		std::size_t capacity = 0;
+		for (const Block& block : m_blocks)
+			capacity += block.size;
+
+		return capacity;
+	}
+
+	/*!
+	* \brief Retrieves a marker of the current arena state
+	* \return Marker which can be used to rewind the arena to its current state
+	*
+	* \see Rewind
+	*/
+	inline auto LinearArena::GetMarker() const -> Marker
+	{
+		Marker marker;
+		marker.m_blockIndex = m_currentBlock;
+		marker.m_offset = m_currentOffset;
+		marker.m_destructorHead = m_destructorHead;
+
+		return marker;
+	}
+
+	/*!
+	* \brief Allocates and constructs an object from the arena
+	* \return Pointer to the constructed object
+	*
+	* \param args Arguments to forward to the constructor
+	*
+	* \remark The object destructor will be called on release if it's not trivially destructible
+	*/
+	template<typename T, typename... Args>
+	T* LinearArena::New(Args&&... args)
+	{
+		if constexpr (std::is_trivially_destructible_v<T>)
+			return PlacementNew(static_cast<T*>(Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+		else
+		{
+			DestructorNode* node = static_cast<DestructorNode*>(Allocate(sizeof(DestructorNode), alignof(DestructorNode)));
+			T* object = PlacementNew(static_cast<T*>(Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+
+			RegisterDestructor(node, object, 1, [](void* ptr, std::size_t /*count*/)
+			{
+				PlacementDestroy(static_cast<T*>(ptr));
+			});
+
+			return object;
+		}
+	}
+
+	/*!
+	* \brief Allocates and value-initializes an array of objects from the arena
+	* \return Pointer to the first object of the array
+	*
+	* \param count Number of objects
+	*
+	* \remark The objects destructors will be called on release if they're not trivially destructible
+	* \remark If a constructor throws, objects constructed so far are destroyed before the exception is propagated
+	* \remark Throws std::bad_array_new_length if the array size overflows
+	*/
+	template<typename T>
+	T* LinearArena::NewArray(std::size_t count)
+	{
+		DestructorNode* node = nullptr;
+		if constexpr (!std::is_trivially_destructible_v<T>)
+			node = static_cast<DestructorNode*>(Allocate(sizeof(DestructorNode), alignof(DestructorNode)));
+
+		if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::bad_array_new_length();
+
+		T* objects = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+
+		// Destroy already constructed objects if a constructor throws
+		std::size_t constructedCount = 0;
+		CallOnExit destroyObjects([&]
+		{
+			for (std::size_t i = constructedCount; i > 0; --i)
+				PlacementDestroy(&objects[i - 1]);
+		});
+
+		for (; constructedCount < count; ++constructedCount)
+			PlacementNew(&objects[constructedCount]);
+
+		destroyObjects.Reset();
+
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			RegisterDestructor(node, objects, count, [](void* ptr, std::size_t objectCount)
+			{
+				T* objectPtr = static_cast<T*>(ptr);
+				for (std::size_t i = objectCount; i > 0; --i)
+					PlacementDestroy(&objectPtr[i - 1]);
+			});
+		}
+
+		return objects;
+	}
+
+	/*!
+	* \brief Resets the arena
+	*
+	* Calls the destructor of every tracked object and makes every block available again for allocations
+	* Note that memory is not freed
+	*
+	* \see Clear
+	*/
+	inline void LinearArena::Reset()
+	{
+		Rewind(Marker{});
+	}
+
+	/*!
+	* \brief Rewinds the arena to a previous state
+	*
+	* Every allocation made since the marker was retrieved is released at once, tracked objects are destroyed in reverse order of construction
+	*
+	* \param marker Marker retrieved with GetMarker
+	*
+	* \remark Rewinding to a marker taken before a previous rewind point is allowed, but not the other way around
+	*/
+	inline void LinearArena::Rewind(const Marker& marker)
+	{
+		while (m_destructorHead != marker.m_destructorHead)
+		{
+			assert(m_destructorHead);
+
+			DestructorNode* node = m_destructorHead;
+			node->destructor(node->object, node->count);
+			m_destructorHead = node->previous;
+		}
+
+		m_currentBlock = marker.m_blockIndex;
+		m_currentOffset = marker.m_offset;
+	}
+
+	inline LinearArena& LinearArena::operator=(LinearArena&& arena) noexcept
+	{
+		Reset();
+
+		m_blockSize = arena.m_blockSize;
+		m_blocks = std::move(arena.m_blocks);
+		m_currentBlock = std::move(arena.m_currentBlock);
+		m_currentOffset = std::move(arena.m_currentOffset);
+		m_destructorHead = std::move(arena.m_destructorHead);
+
+		return *this;
+	}
+
+	inline void LinearArena::AllocateBlock(std::size_t size)
+	{
+		auto& block = m_blocks.emplace_back();
+		block.memory.reset(new std::byte[size]); //< don't use std::make_unique as it would zero the memory
+		block.size = size;
+	}
+
+	inline void LinearArena::RegisterDestructor(DestructorNode* node, void* object, std::size_t count, void(*destructor)(void*, std::size_t))
+	{
+		node->destructor = destructor;
+		node->object = object;
+		node->count = count;
+		node->previous = m_destructorHead;
+
+		m_destructorHead = node;
+	}
+
+
+	/*!
+	* \class Nz::LinearArena::RewindScope
+	* \brief RAII object rewinding an arena to its state at construction when going out of scope
+	*/
+
+	inline LinearArena::RewindScope::RewindScope(LinearArena& arena) :
+	m_arena(arena),
+	m_marker(arena.GetMarker())
+	{
+	}
+
+	inline LinearArena::RewindScope::~RewindScope()
+	{
+		m_arena.Rewind(m_marker);
+	}
+}
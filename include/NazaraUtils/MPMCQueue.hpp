@@ -0,0 +1,63 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_MPMCQUEUE_HPP
+#define NAZARAUTILS_MPMCQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity>
+	class MPMCQueue
+	{
+		static_assert(Capacity > 1 && IsPow2(Capacity), "queue capacity must be a power of two greater than one");
+
+		public:
+			MPMCQueue();
+			MPMCQueue(const MPMCQueue&) = delete;
+			MPMCQueue(MPMCQueue&&) = delete;
+			~MPMCQueue();
+
+			std::size_t GetCapacity() const;
+
+			template<typename... Args> bool TryEmplace(Args&&... args);
+			bool TryPop(T& value);
+			template<typename OutputIt> std::size_t TryPopN(OutputIt output, std::size_t maxCount);
+			bool TryPush(const T& value);
+			bool TryPush(T&& value);
+			template<typename InputIt> std::size_t TryPushN(InputIt input, std::size_t count);
+
+			MPMCQueue& operator=(const MPMCQueue&) = delete;
+			MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+		private:
+			std::size_t ClaimRange(std::atomic<std::size_t>& position, std::size_t maxCount, std::size_t sequenceOffset, std::size_t& firstIndex);
+
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			struct Cell
+			{
+				std::atomic<std::size_t> sequence;
+				alignas(T) std::array<std::byte, sizeof(T)> data;
+
+				T* GetElement();
+			};
+
+			alignas(CacheLineSize) std::atomic<std::size_t> m_enqueuePosition;
+			alignas(CacheLineSize) std::atomic<std::size_t> m_dequeuePosition;
+			alignas(CacheLineSize) std::array<Cell, Capacity> m_cells;
+	};
+}
+
+#include <NazaraUtils/MPMCQueue.inl>
+
+#endif // NAZARAUTILS_MPMCQUEUE_HPP
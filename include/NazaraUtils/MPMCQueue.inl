@@ -0,0 +1,184 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class MPMCQueue
+	* \brief Lock-free bounded queue with inline storage, for any number of producer and consumer threads
+	*
+	* Based on Dmitry Vyukov's bounded MPMC queue: each cell holds a sequence number telling which lap of the queue it is ready for,
+	* producers and consumers claim positions with a single compare-and-swap, batch operations claim a range of ready cells at once.
+	*
+	* \remark An element constructor throwing after its cell has been claimed leaves the queue unusable
+	*/
+
+	template<typename T, std::size_t Capacity>
+	MPMCQueue<T, Capacity>::MPMCQueue() :
+	m_enqueuePosition(0),
+	m_dequeuePosition(0)
+	{
+		for (std::size_t i = 0; i < Capacity; ++i)
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	template<typename T, std::size_t Capacity>
+	MPMCQueue<T, Capacity>::~MPMCQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+			for (std::size_t i = m_dequeuePosition.load(std::memory_order_relaxed); i != enqueuePosition; ++i)
+				PlacementDestroy(m_cells[i & Mask].GetElement());
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	std::size_t MPMCQueue<T, Capacity>::GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	bool MPMCQueue<T, Capacity>::TryEmplace(Args&&... args)
+	{
+		std::size_t position;
+		if (ClaimRange(m_enqueuePosition, 1, 0, position) == 0)
+			return false;
+
+		Cell& cell = m_cells[position & Mask];
+		PlacementNew(cell.GetElement(), std::forward<Args>(args)...);
+		cell.sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MPMCQueue<T, Capacity>::TryPop(T& value)
+	{
+		std::size_t position;
+		if (ClaimRange(m_dequeuePosition, 1, 1, position) == 0)
+			return false;
+
+		Cell& cell = m_cells[position & Mask];
+		T* element = cell.GetElement();
+		value = std::move(*element);
+		PlacementDestroy(element);
+
+		cell.sequence.store(position + Capacity, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Pops up to maxCount consecutive elements with a single position update
+	* \return Number of elements written to output
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename OutputIt>
+	std::size_t MPMCQueue<T, Capacity>::TryPopN(OutputIt output, std::size_t maxCount)
+	{
+		std::size_t position;
+		std::size_t count = ClaimRange(m_dequeuePosition, maxCount, 1, position);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Cell& cell = m_cells[(position + i) & Mask];
+			T* element = cell.GetElement();
+			*output = std::move(*element);
+			++output;
+
+			PlacementDestroy(element);
+			cell.sequence.store(position + i + Capacity, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MPMCQueue<T, Capacity>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool MPMCQueue<T, Capacity>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	/*!
+	* \brief Pushes up to count consecutive elements with a single position update
+	* \return Number of elements read from input (elements are copied unless input is a move iterator)
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	std::size_t MPMCQueue<T, Capacity>::TryPushN(InputIt input, std::size_t count)
+	{
+		std::size_t position;
+		count = ClaimRange(m_enqueuePosition, count, 0, position);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Cell& cell = m_cells[(position + i) & Mask];
+			PlacementNew(cell.GetElement(), *input);
+			++input;
+
+			cell.sequence.store(position + i + 1, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/*!
+	* \brief Claims up to maxCount consecutive cells whose sequence number is their position plus sequenceOffset
+	*
+	* A cell sequence number only changes once the thread owning its position releases it, so cells seen as ready
+	* before the compare-and-swap are still ready once the range has been claimed.
+	*
+	* \return Number of claimed cells (zero if the queue is full when enqueuing or empty when dequeuing)
+	*/
+	template<typename T, std::size_t Capacity>
+	std::size_t MPMCQueue<T, Capacity>::ClaimRange(std::atomic<std::size_t>& position, std::size_t maxCount, std::size_t sequenceOffset, std::size_t& firstIndex)
+	{
+		if (maxCount == 0)
+			return 0;
+
+		std::size_t currentPosition = position.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			std::size_t sequence = m_cells[currentPosition & Mask].sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (currentPosition + sequenceOffset));
+			if (diff < 0)
+				return 0; //< cell has not been released by the previous lap yet
+
+			if (diff > 0)
+			{
+				// Another thread claimed this position
+				currentPosition = position.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			std::size_t count = 1;
+			while (count < maxCount && m_cells[(currentPosition + count) & Mask].sequence.load(std::memory_order_acquire) == currentPosition + count + sequenceOffset)
+				count++;
+
+			if (position.compare_exchange_weak(currentPosition, currentPosition + count, std::memory_order_relaxed))
+			{
+				firstIndex = currentPosition;
+				return count;
+			}
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	T* MPMCQueue<T, Capacity>::Cell::GetElement()
+	{
+		return std::launder(reinterpret_cast<T*>(&data[0]));
+	}
+}
@@ -31,15 +31,38 @@
 
 #endif
 
+#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+
+#define NAZARA_PREFETCH(ptr) __builtin_prefetch(ptr)
+
+#elif defined(NAZARA_COMPILER_MSVC) && (defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64))
+
+#include <xmmintrin.h>
+
+#define NAZARA_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0)
+
+#else
+
+#define NAZARA_PREFETCH(ptr) static_cast<void>(ptr)
+
+#endif
+
+#include <NazaraUtils/TypeTraits.hpp>
 #include <cstddef>
 
 namespace Nz
 {
+	// std::hardware_destructive_interference_size is not available everywhere and its value depends on compiler flags (GCC warns about its use in headers)
+	constexpr std::size_t CacheLineSize = 64;
+
 	template<typename T, typename... Args>
 	constexpr T* PlacementNew(T* ptr, Args&&... args);
 
 	template<typename T>
 	constexpr void PlacementDestroy(T* ptr);
+
+	template<typename T>
+	void Relocate(T* destination, T* source, std::size_t count);
 }
 
 #include <NazaraUtils/MemoryHelper.inl>
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <cassert>
+#include <cstring>
 #include <new>
 #include <utility>
 
@@ -40,4 +41,43 @@ namespace Nz
 		if (ptr)
 			ptr->~T();
 	}
+
+	/*!
+	* \brief Relocates objects to another memory location
+	*
+	* Objects are move-constructed at the destination and then destroyed at the source, or memmove'd if T is trivially relocatable.
+	*
+	* \param destination Pointer to raw memory which will hold the objects
+	* \param source Pointer to the objects to relocate, whose lifetime ends with this call
+	* \param count Number of objects to relocate
+	*
+	* \remark Source and destination ranges may overlap
+	*
+	* \see IsTriviallyRelocatable
+	*/
+	template<typename T>
+	void Relocate(T* destination, T* source, std::size_t count)
+	{
+		if (destination == source || count == 0)
+			return;
+
+		if constexpr (IsTriviallyRelocatable_v<T>)
+			std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+		else if (destination < source)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				PlacementNew(&destination[i], std::move(source[i]));
+				PlacementDestroy(&source[i]);
+			}
+		}
+		else
+		{
+			for (std::size_t i = count; i > 0; --i)
+			{
+				PlacementNew(&destination[i - 1], std::move(source[i - 1]));
+				PlacementDestroy(&source[i - 1]);
+			}
+		}
+	}
 }
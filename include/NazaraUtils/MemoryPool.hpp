@@ -9,25 +9,73 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <array>
 #include <memory>
 #include <vector>
 
 namespace Nz
 {
-	template<typename T, std::size_t Alignment, bool Const>
+	struct MemoryPoolStatistics
+	{
+		static constexpr std::size_t OccupancyHistogramSize = 10;
+
+		std::array<std::size_t, OccupancyHistogramSize> occupancyHistogram = {}; //< Block count by occupancy (0-10%, 10-20%, ..., 90-100%)
+		std::size_t allocatedEntryCount = 0;
+		std::size_t blockCount = 0;
+		std::size_t blockSize = 0;
+		float fragmentation = 0.f; //< Ratio of blocks which could be released if the pool was compacted
+
+		// Only collected by pools with statistics enabled (EnableStatistics template parameter)
+		std::size_t peakAllocatedEntryCount = 0;
+		std::size_t intervalAllocationCount = 0;
+		std::size_t intervalFreeCount = 0;
+		std::size_t totalAllocationCount = 0;
+		std::size_t totalFreeCount = 0;
+		float averageSearchLength = 0.f; //< Average number of blocks inspected by allocations during the interval
+	};
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
 	class MemoryPoolIterator;
 
-	template<typename T, std::size_t Alignment = alignof(T)>
-	class MemoryPool
+	namespace Detail
+	{
+		// Inherited by MemoryPool so that disabled statistics take no space (empty base optimization)
+		template<bool EnableStatistics>
+		struct MemoryPoolCounters
+		{
+		};
+
+		template<>
+		struct MemoryPoolCounters<true>
+		{
+			struct Counters
+			{
+				std::size_t allocatedEntryCount = 0;
+				std::size_t peakAllocatedEntryCount = 0;
+				std::size_t intervalAllocationCount = 0;
+				std::size_t intervalFreeCount = 0;
+				std::size_t intervalSearchLength = 0;
+				std::size_t totalAllocationCount = 0;
+				std::size_t totalFreeCount = 0;
+			};
+
+			Counters m_counters;
+		};
+	}
+
+	template<typename T, std::size_t Alignment = alignof(T), bool EnableStatistics = false>
+	class MemoryPool : private Detail::MemoryPoolCounters<EnableStatistics>
 	{
 		public:
-			using const_iterator = MemoryPoolIterator<T, Alignment, true>;
-			using iterator = MemoryPoolIterator<T, Alignment, false>;
+			using const_iterator = MemoryPoolIterator<T, Alignment, EnableStatistics, true>;
+			using iterator = MemoryPoolIterator<T, Alignment, EnableStatistics, false>;
 			friend const_iterator;
 			friend iterator;
 
 			class DeferConstruct_t {};
 			class NoDestruction_t {};
+			using RelocateCallback = FunctionRef<void(std::size_t oldIndex, std::size_t newIndex)>;
 
 			MemoryPool(std::size_t blockSize);
 			MemoryPool(const MemoryPool&) = delete;
@@ -39,6 +87,11 @@ namespace Nz
 
 			void Clear();
 
+			std::size_t Compact(const RelocateCallback& callback = nullptr);
+
+			template<typename F> void ForEach(F&& func);
+			template<typename F> void ForEach(F&& func) const;
+
 			void Free(std::size_t index);
 			void Free(std::size_t index, NoDestruction_t);
 
@@ -46,8 +99,13 @@ namespace Nz
 			std::size_t GetBlockCount() const;
 			std::size_t GetBlockSize() const;
 			std::size_t GetFreeEntryCount() const;
+			MemoryPoolStatistics GetStatistics() const;
+
+			template<typename Executor, typename F> void ParallelForEach(Executor&& executor, F&& func);
+			template<typename Executor, typename F> void ParallelForEach(Executor&& executor, F&& func) const;
 
 			void Reset();
+			void ResetStatisticsInterval();
 
 			T* RetrieveFromIndex(std::size_t index);
 			const T* RetrieveFromIndex(std::size_t index) const;
@@ -66,16 +124,24 @@ namespace Nz
 			MemoryPool& operator=(MemoryPool&& pool) noexcept = default;
 
 			static constexpr DeferConstruct_t DeferConstruct = {};
+			static constexpr bool HasStatistics = EnableStatistics;
 			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
 			static constexpr NoDestruction_t NoDestruction = {};
 
 		private:
 			void AllocateBlock();
+			template<typename U, typename F> void ForEachInBlock(std::size_t blockIndex, F& func) const;
 			T* GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex);
 			const T* GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const;
 			std::pair<std::size_t, std::size_t> GetFirstAllocatedEntry() const;
 			std::pair<std::size_t, std::size_t> GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const;
+			std::pair<std::size_t, std::size_t> GetFirstFreeEntryFromBlock(std::size_t blockIndex) const;
+			std::pair<std::size_t, std::size_t> GetLastAllocatedEntryFromBlock(std::size_t blockIndex) const;
 			std::pair<std::size_t, std::size_t> GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const;
+			std::pair<std::size_t, std::size_t> GetNextFreeEntry(std::size_t blockIndex, std::size_t localIndex) const;
+			std::pair<std::size_t, std::size_t> GetPreviousAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const;
+
+			static std::size_t FindLastBitBefore(const Bitset<UInt64>& bitset, std::size_t bit);
 
 			using AlignedStorage = std::aligned_storage_t<sizeof(T), Alignment>;
 
@@ -91,10 +157,10 @@ namespace Nz
 			std::vector<Block> m_blocks;
 	};
 
-	template<typename T, std::size_t Alignment, bool Const>
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
 	class MemoryPoolIterator
 	{
-		using Pool = MemoryPool<T, Alignment>;
+		using Pool = MemoryPool<T, Alignment, EnableStatistics>;
 		friend Pool;
 
 		public:
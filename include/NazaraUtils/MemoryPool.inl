@@ -4,6 +4,7 @@
 
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/MemoryHelper.hpp>
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
@@ -13,6 +14,8 @@ namespace Nz
 	* \ingroup utils
 	* \class Nz::MemoryPool
 	* \brief Core class that represents a memory pool
+	*
+	* Allocation and free counters (see GetStatistics) are only collected if the EnableStatistics template parameter is true.
 	*/
 
 	/*!
@@ -20,8 +23,8 @@ namespace Nz
 	*
 	* \param blockSize Size of blocks that will be allocated
 	*/
-	template<typename T, std::size_t Alignment>
-	MemoryPool<T, Alignment>::MemoryPool(std::size_t blockSize) :
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	MemoryPool<T, Alignment, EnableStatistics>::MemoryPool(std::size_t blockSize) :
 	m_blockSize(blockSize)
 	{
 		// Allocate one block by default
@@ -31,8 +34,8 @@ namespace Nz
 	/*!
 	* \brief Destroy the memory pool, calling the destructor for every allocated object and desallocating blocks
 	*/
-	template<typename T, std::size_t Alignment>
-	MemoryPool<T, Alignment>::~MemoryPool()
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	MemoryPool<T, Alignment, EnableStatistics>::~MemoryPool()
 	{
 		Reset();
 	}
@@ -43,8 +46,8 @@ namespace Nz
 	*
 	* \param index Output entry index (which can be used for deallocation)
 	*/
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::Allocate(DeferConstruct_t, std::size_t& index)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	T* MemoryPool<T, Alignment, EnableStatistics>::Allocate(DeferConstruct_t, std::size_t& index)
 	{
 		std::size_t blockIndex = 0;
 		std::size_t localIndex = InvalidIndex;
@@ -75,6 +78,15 @@ namespace Nz
 		block.occupiedEntries.Set(localIndex);
 		block.occupiedEntryCount++;
 
+		if constexpr (EnableStatistics)
+		{
+			this->m_counters.allocatedEntryCount++;
+			this->m_counters.peakAllocatedEntryCount = std::max(this->m_counters.peakAllocatedEntryCount, this->m_counters.allocatedEntryCount);
+			this->m_counters.intervalAllocationCount++;
+			this->m_counters.intervalSearchLength += blockIndex + 1;
+			this->m_counters.totalAllocationCount++;
+		}
+
 		T* entry = std::launder(reinterpret_cast<T*>(&block.memory[localIndex]));
 
 		index = blockIndex * m_blockSize + localIndex;
@@ -88,9 +100,9 @@ namespace Nz
 	*
 	* \param index Output entry index (which can be used for deallocation)
 	*/
-	template<typename T, std::size_t Alignment>
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
 	template<typename... Args>
-	T* MemoryPool<T, Alignment>::Allocate(std::size_t& index, Args&&... args)
+	T* MemoryPool<T, Alignment, EnableStatistics>::Allocate(std::size_t& index, Args&&... args)
 	{
 		T* entry = Allocate(DeferConstruct, index);
 		PlacementNew(entry, std::forward<Args>(args)...);
@@ -105,14 +117,99 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Clear()
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::Clear()
 	{
 		Reset();
 
 		m_blocks.clear();
 	}
 
+	/*!
+	* \brief Moves allocated entries toward the first blocks and frees the blocks left empty at the end of the pool
+	* \return Number of entries that were relocated
+	*
+	* Entries with the highest indices are move-constructed into the free entries with the lowest indices (and then destroyed),
+	* until every free entry is located after every allocated entry. This restores iteration density of pools which had lots of entries freed.
+	*
+	* \param callback Optional function called with the old and new index of every relocated entry (after it has been moved), allowing handles to be updated
+	*
+	* \remark This invalidates pointers and indices to relocated entries, as well as iterators
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::Compact(const RelocateCallback& callback)
+	{
+		static_assert(std::is_move_constructible_v<T>, "T must be move-constructible to be relocated");
+
+		std::size_t relocatedCount = 0;
+
+		auto freeEntry = GetFirstFreeEntryFromBlock(0);
+		auto allocatedEntry = GetLastAllocatedEntryFromBlock(m_blocks.size() - 1);
+		while (freeEntry.first != InvalidIndex && allocatedEntry.first != InvalidIndex && freeEntry < allocatedEntry)
+		{
+			auto& srcBlock = m_blocks[allocatedEntry.first];
+			auto& dstBlock = m_blocks[freeEntry.first];
+
+			T* srcPtr = GetAllocatedPointer(allocatedEntry.first, allocatedEntry.second);
+			T* dstPtr = std::launder(reinterpret_cast<T*>(&dstBlock.memory[freeEntry.second]));
+			PlacementNew(dstPtr, std::move(*srcPtr));
+			PlacementDestroy(srcPtr);
+
+			dstBlock.freeEntries.Reset(freeEntry.second);
+			dstBlock.occupiedEntries.Set(freeEntry.second);
+			dstBlock.occupiedEntryCount++;
+
+			srcBlock.freeEntries.Set(allocatedEntry.second);
+			srcBlock.occupiedEntries.Reset(allocatedEntry.second);
+			srcBlock.occupiedEntryCount--;
+
+			relocatedCount++;
+
+			if (callback)
+				callback(allocatedEntry.first * m_blockSize + allocatedEntry.second, freeEntry.first * m_blockSize + freeEntry.second);
+
+			freeEntry = GetNextFreeEntry(freeEntry.first, freeEntry.second);
+			allocatedEntry = GetPreviousAllocatedEntry(allocatedEntry.first, allocatedEntry.second);
+		}
+
+		// Only trailing blocks can be released without changing the indices of the remaining entries
+		while (!m_blocks.empty() && m_blocks.back().occupiedEntryCount == 0)
+			m_blocks.pop_back();
+
+		return relocatedCount;
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool
+	*
+	* This is faster than iterating using begin()/end() as the occupancy bitset is scanned word by word.
+	* Entries are visited in increasing index order.
+	*
+	* \param func Function called with a reference to each allocated entry (T&), or with its index and a reference to it (std::size_t, T&)
+	*
+	* \remark Freeing the visited entry from func is allowed, allocating from the pool is not
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	template<typename F>
+	void MemoryPool<T, Alignment, EnableStatistics>::ForEach(F&& func)
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+			ForEachInBlock<T>(blockIndex, func);
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool
+	*
+	* \param func Function called with a const reference to each allocated entry (const T&), or with its index and a const reference to it (std::size_t, const T&)
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	template<typename F>
+	void MemoryPool<T, Alignment, EnableStatistics>::ForEach(F&& func) const
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+			ForEachInBlock<const T>(blockIndex, func);
+	}
+
 	/*!
 	* \brief Returns an object memory to the memory pool
 	*
@@ -122,8 +219,8 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Free(std::size_t index)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::Free(std::size_t index)
 	{
 		std::size_t blockIndex = index / m_blockSize;
 		std::size_t localIndex = index % m_blockSize;
@@ -137,6 +234,13 @@ namespace Nz
 
 		block.freeEntries.Set(localIndex);
 		block.occupiedEntries.Reset(localIndex);
+
+		if constexpr (EnableStatistics)
+		{
+			this->m_counters.allocatedEntryCount--;
+			this->m_counters.intervalFreeCount++;
+			this->m_counters.totalFreeCount++;
+		}
 	}
 	
 	/*!
@@ -148,8 +252,8 @@ namespace Nz
 	*
 	* \see Reset
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Free(std::size_t index, NoDestruction_t)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::Free(std::size_t index, NoDestruction_t)
 	{
 		std::size_t blockIndex = index / m_blockSize;
 		std::size_t localIndex = index % m_blockSize;
@@ -160,14 +264,21 @@ namespace Nz
 
 		block.freeEntries.Set(localIndex);
 		block.occupiedEntries.Reset(localIndex);
+
+		if constexpr (EnableStatistics)
+		{
+			this->m_counters.allocatedEntryCount--;
+			this->m_counters.intervalFreeCount++;
+			this->m_counters.totalFreeCount++;
+		}
 	}
 
 	/*!
 	* \brief Returns the number of allocated entries
 	* \return How many entries are currently allocated
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetAllocatedEntryCount() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::GetAllocatedEntryCount() const
 	{
 		std::size_t count = 0;
 		for (auto& block : m_blocks)
@@ -180,8 +291,8 @@ namespace Nz
 	* \brief Gets the block count
 	* \return How many block are currently allocated for this memory pool
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetBlockCount() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::GetBlockCount() const
 	{
 		return m_blocks.size();
 	}
@@ -190,8 +301,8 @@ namespace Nz
 	* \brief Gets the block size
 	* \return Size of each block (i.e. how many items can fit in a block)
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetBlockSize() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::GetBlockSize() const
 	{
 		return m_blockSize;
 	}
@@ -200,13 +311,106 @@ namespace Nz
 	* \brief Returns the number of free entries
 	* \return How many entries are currently freed
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::GetFreeEntryCount() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::GetFreeEntryCount() const
 	{
 		std::size_t count = m_blocks.size() * m_blockSize;
 		return count - GetAllocatedEntryCount();
 	}
 
+	/*!
+	* \brief Computes statistics about the pool usage
+	* \return A snapshot of the pool statistics
+	*
+	* Occupancy and fragmentation are computed from the current state of the pool,
+	* other counters are only collected if the pool has statistics enabled (see HasStatistics) and are left to zero otherwise.
+	*
+	* \remark This has to go through every block and should not be called too frequently
+	*
+	* \see ResetStatisticsInterval
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	MemoryPoolStatistics MemoryPool<T, Alignment, EnableStatistics>::GetStatistics() const
+	{
+		constexpr std::size_t histogramSize = MemoryPoolStatistics::OccupancyHistogramSize;
+
+		MemoryPoolStatistics statistics;
+		statistics.blockCount = m_blocks.size();
+		statistics.blockSize = m_blockSize;
+
+		for (auto& block : m_blocks)
+		{
+			statistics.allocatedEntryCount += block.occupiedEntryCount;
+			statistics.occupancyHistogram[std::min(block.occupiedEntryCount * histogramSize / m_blockSize, histogramSize - 1)]++;
+		}
+
+		if (!m_blocks.empty())
+		{
+			std::size_t minimalBlockCount = (statistics.allocatedEntryCount + m_blockSize - 1) / m_blockSize;
+			statistics.fragmentation = 1.f - float(minimalBlockCount) / float(m_blocks.size());
+		}
+
+		if constexpr (EnableStatistics)
+		{
+			statistics.peakAllocatedEntryCount = this->m_counters.peakAllocatedEntryCount;
+			statistics.intervalAllocationCount = this->m_counters.intervalAllocationCount;
+			statistics.intervalFreeCount = this->m_counters.intervalFreeCount;
+			statistics.totalAllocationCount = this->m_counters.totalAllocationCount;
+			statistics.totalFreeCount = this->m_counters.totalFreeCount;
+			if (this->m_counters.intervalAllocationCount > 0)
+				statistics.averageSearchLength = float(this->m_counters.intervalSearchLength) / float(this->m_counters.intervalAllocationCount);
+		}
+
+		return statistics;
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool, splitting the work by block
+	*
+	* The executor is called once as executor(jobCount, job), with job being a FunctionRef<void(std::size_t)>.
+	* It has to call job with every index in [0, jobCount), in any order and from any thread, and must only return once every job has completed.
+	* Each job visits a single block, blocks are never shared between jobs.
+	*
+	* \param executor Object responsible for dispatching jobs on threads
+	* \param func Function called with a reference to each allocated entry (T&), or with its index and a reference to it (std::size_t, T&)
+	*
+	* \remark func will be called concurrently and must be thread-safe
+	* \remark The pool must not be modified while this function is running
+	*
+	* \see ForEach
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	template<typename Executor, typename F>
+	void MemoryPool<T, Alignment, EnableStatistics>::ParallelForEach(Executor&& executor, F&& func)
+	{
+		auto job = [&](std::size_t blockIndex)
+		{
+			ForEachInBlock<T>(blockIndex, func);
+		};
+
+		std::forward<Executor>(executor)(m_blocks.size(), FunctionRef<void(std::size_t)>(job));
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool, splitting the work by block
+	*
+	* \param executor Object responsible for dispatching jobs on threads
+	* \param func Function called with a const reference to each allocated entry (const T&), or with its index and a const reference to it (std::size_t, const T&)
+	*
+	* \see ParallelForEach
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	template<typename Executor, typename F>
+	void MemoryPool<T, Alignment, EnableStatistics>::ParallelForEach(Executor&& executor, F&& func) const
+	{
+		auto job = [&](std::size_t blockIndex)
+		{
+			ForEachInBlock<const T>(blockIndex, func);
+		};
+
+		std::forward<Executor>(executor)(m_blocks.size(), FunctionRef<void(std::size_t)>(job));
+	}
+
 	/*!
 	* \brief Resets the memory pool
 	*
@@ -215,8 +419,8 @@ namespace Nz
 	*
 	* \see Clear
 	*/
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::Reset()
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::Reset()
 	{
 		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
 		{
@@ -234,6 +438,34 @@ namespace Nz
 			block.occupiedEntries.Reset(false);
 			block.occupiedEntryCount = 0;
 		}
+
+		if constexpr (EnableStatistics)
+		{
+			// Entries destroyed by a reset count as freed
+			this->m_counters.intervalFreeCount += this->m_counters.allocatedEntryCount;
+			this->m_counters.totalFreeCount += this->m_counters.allocatedEntryCount;
+			this->m_counters.allocatedEntryCount = 0;
+		}
+	}
+
+	/*!
+	* \brief Starts a new statistics interval
+	*
+	* Resets interval allocation/free counts and the average search length, typically called once per frame.
+	*
+	* \remark This does nothing if the pool has statistics disabled
+	*
+	* \see GetStatistics
+	*/
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::ResetStatisticsInterval()
+	{
+		if constexpr (EnableStatistics)
+		{
+			this->m_counters.intervalAllocationCount = 0;
+			this->m_counters.intervalFreeCount = 0;
+			this->m_counters.intervalSearchLength = 0;
+		}
 	}
 
 	/*!
@@ -245,8 +477,8 @@ namespace Nz
 	*
 	* \remark index must be valid
 	*/
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	T* MemoryPool<T, Alignment, EnableStatistics>::RetrieveFromIndex(std::size_t index)
 	{
 		std::size_t blockIndex = index / m_blockSize;
 		std::size_t localIndex = index % m_blockSize;
@@ -263,8 +495,8 @@ namespace Nz
 	*
 	* \remark index must be valid
 	*/
-	template<typename T, std::size_t Alignment>
-	const T* MemoryPool<T, Alignment>::RetrieveFromIndex(std::size_t index) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	const T* MemoryPool<T, Alignment, EnableStatistics>::RetrieveFromIndex(std::size_t index) const
 	{
 		std::size_t blockIndex = index / m_blockSize;
 		std::size_t localIndex = index % m_blockSize;
@@ -279,8 +511,8 @@ namespace Nz
 	* 
 	* \return Corresponding index, or InvalidIndex if it's not part of this pool
 	*/
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::RetrieveEntryIndex(const T* data)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::RetrieveEntryIndex(const T* data)
 	{
 		std::size_t blockIndex = 0;
 		std::size_t localIndex = InvalidIndex;
@@ -306,52 +538,52 @@ namespace Nz
 		return blockIndex * m_blockSize + localIndex;
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::begin() -> iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::begin() -> iterator
 	{
 		auto [blockIndex, localIndex] = GetFirstAllocatedEntry();
 		return iterator(this, blockIndex, localIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::begin() const -> const_iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::begin() const -> const_iterator
 	{
 		return cbegin();
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::cbegin() const -> const_iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::cbegin() const -> const_iterator
 	{
 		auto [blockIndex, localIndex] = GetFirstAllocatedEntry();
 		return const_iterator(this, blockIndex, localIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::end() -> iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::end() -> iterator
 	{
 		return iterator(this, InvalidIndex, InvalidIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::end() const -> const_iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::end() const -> const_iterator
 	{
 		return cend();
 	}
 
-	template<typename T, std::size_t Alignment>
-	auto MemoryPool<T, Alignment>::cend() const -> const_iterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	auto MemoryPool<T, Alignment, EnableStatistics>::cend() const -> const_iterator
 	{
 		return const_iterator(this, InvalidIndex, InvalidIndex);
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::size_t MemoryPool<T, Alignment>::size()
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::size()
 	{
 		return GetAllocatedEntryCount();
 	}
 
-	template<typename T, std::size_t Alignment>
-	void MemoryPool<T, Alignment>::AllocateBlock()
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	void MemoryPool<T, Alignment, EnableStatistics>::AllocateBlock()
 	{
 		auto& block = m_blocks.emplace_back();
 		block.freeEntries.Resize(m_blockSize, true);
@@ -359,8 +591,44 @@ namespace Nz
 		block.memory = std::make_unique<AlignedStorage[]>(m_blockSize);
 	}
 
-	template<typename T, std::size_t Alignment>
-	T* MemoryPool<T, Alignment>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex)
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	template<typename U, typename F>
+	void MemoryPool<T, Alignment, EnableStatistics>::ForEachInBlock(std::size_t blockIndex, F& func) const
+	{
+		constexpr std::size_t bitsPerWord = Bitset<UInt64>::bitsPerBlock;
+
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+
+		std::size_t remainingEntries = block.occupiedEntryCount;
+		std::size_t wordCount = block.occupiedEntries.GetBlockCount();
+		for (std::size_t wordIndex = 0; wordIndex < wordCount && remainingEntries > 0; ++wordIndex)
+		{
+			UInt64 word = block.occupiedEntries.GetBlock(wordIndex);
+			std::size_t baseIndex = wordIndex * bitsPerWord;
+
+			while (word != 0)
+			{
+				std::size_t localIndex = baseIndex + FindFirstBit(word) - 1;
+				word &= word - 1; //< clear lowest set bit
+
+				// Fetch next entry while we're processing this one (hardware prefetchers won't guess it if the block is sparse)
+				if (word != 0)
+					NAZARA_PREFETCH(&block.memory[baseIndex + FindFirstBit(word) - 1]);
+
+				U* entry = std::launder(reinterpret_cast<U*>(&block.memory[localIndex]));
+				if constexpr (std::is_invocable_v<F&, U&>)
+					func(*entry);
+				else
+					func(blockIndex * m_blockSize + localIndex, *entry);
+
+				remainingEntries--;
+			}
+		}
+	}
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	T* MemoryPool<T, Alignment, EnableStatistics>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex)
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
@@ -369,8 +637,8 @@ namespace Nz
 		return std::launder(reinterpret_cast<T*>(&block.memory[localIndex]));
 	}
 
-	template<typename T, std::size_t Alignment>
-	const T* MemoryPool<T, Alignment>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	const T* MemoryPool<T, Alignment, EnableStatistics>::GetAllocatedPointer(std::size_t blockIndex, std::size_t localIndex) const
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
@@ -379,14 +647,14 @@ namespace Nz
 		return std::launder(reinterpret_cast<const T*>(&block.memory[localIndex]));
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetFirstAllocatedEntry() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetFirstAllocatedEntry() const
 	{
 		return GetFirstAllocatedEntryFromBlock(0);
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetFirstAllocatedEntryFromBlock(std::size_t blockIndex) const
 	{
 		// Search in next block
 		std::size_t localIndex = InvalidIndex;
@@ -407,8 +675,43 @@ namespace Nz
 		return { blockIndex, localIndex };
 	}
 
-	template<typename T, std::size_t Alignment>
-	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment>::GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetFirstFreeEntryFromBlock(std::size_t blockIndex) const
+	{
+		for (; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			auto& block = m_blocks[blockIndex];
+			if (block.occupiedEntryCount == m_blockSize)
+				continue;
+
+			std::size_t localIndex = block.freeEntries.FindFirst();
+			assert(localIndex != block.freeEntries.npos);
+			return { blockIndex, localIndex };
+		}
+
+		return { InvalidIndex, InvalidIndex };
+	}
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetLastAllocatedEntryFromBlock(std::size_t blockIndex) const
+	{
+		// Search in previous blocks (blockIndex wraps around to InvalidIndex when going past the first block)
+		for (; blockIndex < m_blocks.size(); --blockIndex)
+		{
+			auto& block = m_blocks[blockIndex];
+			if (block.occupiedEntryCount == 0)
+				continue;
+
+			std::size_t localIndex = FindLastBitBefore(block.occupiedEntries, m_blockSize);
+			assert(localIndex != block.occupiedEntries.npos);
+			return { blockIndex, localIndex };
+		}
+
+		return { InvalidIndex, InvalidIndex };
+	}
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetNextAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const
 	{
 		assert(blockIndex < m_blocks.size());
 		auto& block = m_blocks[blockIndex];
@@ -420,33 +723,84 @@ namespace Nz
 		return GetFirstAllocatedEntryFromBlock(blockIndex + 1);
 	}
 
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetNextFreeEntry(std::size_t blockIndex, std::size_t localIndex) const
+	{
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+		std::size_t nextLocalIndex = block.freeEntries.FindNext(localIndex);
+		if (nextLocalIndex != block.freeEntries.npos)
+			return { blockIndex, nextLocalIndex };
+
+		// Search in next block
+		return GetFirstFreeEntryFromBlock(blockIndex + 1);
+	}
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::pair<std::size_t, std::size_t> MemoryPool<T, Alignment, EnableStatistics>::GetPreviousAllocatedEntry(std::size_t blockIndex, std::size_t localIndex) const
+	{
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+		std::size_t previousLocalIndex = FindLastBitBefore(block.occupiedEntries, localIndex);
+		if (previousLocalIndex != block.occupiedEntries.npos)
+			return { blockIndex, previousLocalIndex };
+
+		// Search in previous block
+		return GetLastAllocatedEntryFromBlock(blockIndex - 1);
+	}
+
+	template<typename T, std::size_t Alignment, bool EnableStatistics>
+	std::size_t MemoryPool<T, Alignment, EnableStatistics>::FindLastBitBefore(const Bitset<UInt64>& bitset, std::size_t bit)
+	{
+		constexpr std::size_t bitsPerWord = Bitset<UInt64>::bitsPerBlock;
+
+		// Look for the last enabled bit strictly before bit, word by word
+		std::size_t wordIndex = bit / bitsPerWord;
+		std::size_t bitIndex = bit % bitsPerWord;
+		if (bitIndex != 0)
+		{
+			UInt64 word = bitset.GetBlock(wordIndex) & ((UInt64(1) << bitIndex) - 1);
+			if (word != 0)
+				return wordIndex * bitsPerWord + FindLastBit(word) - 1;
+		}
+
+		while (wordIndex-- > 0)
+		{
+			UInt64 word = bitset.GetBlock(wordIndex);
+			if (word != 0)
+				return wordIndex * bitsPerWord + FindLastBit(word) - 1;
+		}
+
+		return bitset.npos;
+	}
+
 
-	template<typename T, std::size_t Alignment, bool Const>
-	MemoryPoolIterator<T, Alignment, Const>::MemoryPoolIterator(std::conditional_t<Const, const Pool, Pool>* owner, std::size_t blockIndex, std::size_t localIndex) :
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::MemoryPoolIterator(std::conditional_t<Const, const Pool, Pool>* owner, std::size_t blockIndex, std::size_t localIndex) :
 	m_blockIndex(blockIndex),
 	m_localIndex(localIndex),
 	m_owner(owner)
 	{
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	std::size_t MemoryPoolIterator<T, Alignment, Const>::GetIndex() const
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	std::size_t MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::GetIndex() const
 	{
 		assert(m_blockIndex != Pool::InvalidIndex);
 		assert(m_localIndex != Pool::InvalidIndex);
 		return m_blockIndex * m_owner->GetBlockSize() + m_localIndex;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator++(int) -> MemoryPoolIterator
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	auto MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::operator++(int) -> MemoryPoolIterator
 	{
 		MemoryPoolIterator copy(*this);
 		operator++();
 		return copy;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator++() -> MemoryPoolIterator&
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	auto MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::operator++() -> MemoryPoolIterator&
 	{
 		auto [blockIndex, localIndex] = m_owner->GetNextAllocatedEntry(m_blockIndex, m_localIndex);
 		m_blockIndex = blockIndex;
@@ -455,21 +809,21 @@ namespace Nz
 		return *this;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	bool MemoryPoolIterator<T, Alignment, Const>::operator==(const MemoryPoolIterator& rhs) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	bool MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::operator==(const MemoryPoolIterator& rhs) const
 	{
 		assert(m_owner == rhs.m_owner);
 		return m_blockIndex == rhs.m_blockIndex && m_localIndex == rhs.m_localIndex;
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	bool MemoryPoolIterator<T, Alignment, Const>::operator!=(const MemoryPoolIterator& rhs) const
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	bool MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::operator!=(const MemoryPoolIterator& rhs) const
 	{
 		return !operator==(rhs);
 	}
 
-	template<typename T, std::size_t Alignment, bool Const>
-	auto MemoryPoolIterator<T, Alignment, Const>::operator*() const -> reference
+	template<typename T, std::size_t Alignment, bool EnableStatistics, bool Const>
+	auto MemoryPoolIterator<T, Alignment, EnableStatistics, Const>::operator*() const -> reference
 	{
 		return *m_owner->GetAllocatedPointer(m_blockIndex, m_localIndex);
 	}
@@ -0,0 +1,76 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_MEMORYRESOURCE_HPP
+#define NAZARAUTILS_MEMORYRESOURCE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/LinearArena.hpp>
+#include <NazaraUtils/SlabAllocator.hpp>
+#include <memory_resource>
+#include <vector>
+
+namespace Nz
+{
+	class ArenaMemoryResource : public std::pmr::memory_resource
+	{
+		public:
+			explicit ArenaMemoryResource(LinearArena& arena);
+			ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+			ArenaMemoryResource(ArenaMemoryResource&&) = delete;
+			~ArenaMemoryResource() = default;
+
+			LinearArena& GetArena() const;
+
+			ArenaMemoryResource& operator=(const ArenaMemoryResource&) = delete;
+			ArenaMemoryResource& operator=(ArenaMemoryResource&&) = delete;
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+			void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		private:
+			LinearArena& m_arena;
+	};
+
+	class PoolMemoryResource : public std::pmr::memory_resource
+	{
+		public:
+			explicit PoolMemoryResource(std::size_t slabSize = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+			PoolMemoryResource(const PoolMemoryResource&) = delete;
+			PoolMemoryResource(PoolMemoryResource&&) = delete;
+			~PoolMemoryResource() = default;
+
+			std::size_t GetAllocatedEntryCount() const;
+			const SlabAllocator& GetSlabAllocator() const;
+			std::pmr::memory_resource* GetUpstreamResource() const;
+
+			void Release();
+
+			PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+			PoolMemoryResource& operator=(PoolMemoryResource&&) = delete;
+
+		protected:
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+			void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		private:
+			static constexpr bool IsPoolable(std::size_t bytes, std::size_t alignment);
+
+			std::pmr::memory_resource* m_upstream;
+			SlabAllocator m_slabAllocator;
+	};
+
+	template<typename T, std::size_t Capacity>
+	using PmrHybridVector = HybridVector<T, Capacity, std::pmr::polymorphic_allocator<T>>;
+}
+
+#include <NazaraUtils/MemoryResource.inl>
+
+#endif // NAZARAUTILS_MEMORYRESOURCE_HPP
@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cassert>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::ArenaMemoryResource
+	* \brief std::pmr::memory_resource allocating from a LinearArena
+	*
+	* Deallocation is a no-op (as with std::pmr::monotonic_buffer_resource), memory is released when the arena is reset or rewound.
+	* The arena is referenced and must outlive the resource and everything allocated from it.
+	*/
+
+	/*!
+	* \brief Constructs an ArenaMemoryResource object allocating from an arena
+	*
+	* \param arena Arena to allocate from
+	*/
+	inline ArenaMemoryResource::ArenaMemoryResource(LinearArena& arena) :
+	m_arena(arena)
+	{
+	}
+
+	/*!
+	* \brief Gets the arena used by this resource
+	* \return Reference to the arena
+	*/
+	inline LinearArena& ArenaMemoryResource::GetArena() const
+	{
+		return m_arena;
+	}
+
+	inline void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		return m_arena.Allocate(bytes, alignment);
+	}
+
+	inline void ArenaMemoryResource::do_deallocate(void* /*ptr*/, std::size_t /*bytes*/, std::size_t /*alignment*/)
+	{
+	}
+
+	inline bool ArenaMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+
+	/*!
+	* \ingroup utils
+	* \class Nz::PoolMemoryResource
+	* \brief std::pmr::memory_resource serving small allocations from a SlabAllocator
+	*
+	* Allocations up to SlabAllocator::MaxSizeClass bytes (and aligned to at most alignof(std::max_align_t)) are rounded up to their size class
+	* and served by the slab allocator, bigger or over-aligned allocations are forwarded to the upstream resource.
+	*
+	* \remark This resource is not thread-safe (as std::pmr::unsynchronized_pool_resource)
+	*/
+
+	/*!
+	* \brief Constructs a PoolMemoryResource object
+	*
+	* \param slabSize Size of the slabs of the underlying slab allocator
+	* \param upstream Resource used for allocations too big to be pooled
+	*/
+	inline PoolMemoryResource::PoolMemoryResource(std::size_t slabSize, std::pmr::memory_resource* upstream) :
+	m_upstream(upstream),
+	m_slabAllocator(slabSize)
+	{
+		assert(m_upstream);
+	}
+
+	/*!
+	* \brief Gets the number of pooled allocations currently alive
+	* \return Allocated entry count of the slab allocator (allocations forwarded upstream are not counted)
+	*/
+	inline std::size_t PoolMemoryResource::GetAllocatedEntryCount() const
+	{
+		return m_slabAllocator.GetAllocatedEntryCount();
+	}
+
+	/*!
+	* \brief Gets the slab allocator serving pooled allocations
+	* \return Reference to the slab allocator
+	*/
+	inline const SlabAllocator& PoolMemoryResource::GetSlabAllocator() const
+	{
+		return m_slabAllocator;
+	}
+
+	/*!
+	* \brief Gets the upstream resource
+	* \return Resource used for allocations which are too big to be pooled
+	*/
+	inline std::pmr::memory_resource* PoolMemoryResource::GetUpstreamResource() const
+	{
+		return m_upstream;
+	}
+
+	/*!
+	* \brief Releases all the memory owned by the slab allocator
+	*
+	* Every pooled allocation is invalidated, even if it wasn't deallocated (allocations forwarded upstream are left untouched)
+	*/
+	inline void PoolMemoryResource::Release()
+	{
+		m_slabAllocator.Clear();
+	}
+
+	inline void* PoolMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		if (!IsPoolable(bytes, alignment))
+			return m_upstream->allocate(bytes, alignment);
+
+		return m_slabAllocator.Allocate(std::max(bytes, alignment));
+	}
+
+	inline void PoolMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+	{
+		if (!IsPoolable(bytes, alignment))
+			return m_upstream->deallocate(ptr, bytes, alignment);
+
+		m_slabAllocator.Free(ptr, std::max(bytes, alignment));
+	}
+
+	inline bool PoolMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	constexpr bool PoolMemoryResource::IsPoolable(std::size_t bytes, std::size_t alignment)
+	{
+		// Slab entries are aligned to min(size class, alignof(std::max_align_t)) and size classes are never smaller than the requested size
+		return alignment <= alignof(std::max_align_t) && std::max(bytes, alignment) <= SlabAllocator::MaxSizeClass;
+	}
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_PARALLELALGORITHM_HPP
+#define NAZARAUTILS_PARALLELALGORITHM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, typename = void>
+		struct IsSizedRange : std::false_type {};
+
+		template<typename T>
+		struct IsSizedRange<T, std::void_t<decltype(std::begin(std::declval<T&>())), decltype(std::size(std::declval<T&>()))>> : std::true_type {};
+
+		template<typename T>
+		using EnableIfSizedRange = std::enable_if_t<IsSizedRange<std::remove_reference_t<T>>::value>;
+
+		template<typename T>
+		using EnableIfNotSizedRange = std::enable_if_t<!IsSizedRange<std::remove_reference_t<T>>::value>;
+	}
+
+	template<typename F> void ParallelFor(TaskScheduler& scheduler, std::size_t count, std::size_t grainSize, F&& func);
+	template<typename It, typename F, typename = Detail::EnableIfNotSizedRange<It>> void ParallelFor(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, F&& func);
+	template<typename Range, typename F, typename = Detail::EnableIfSizedRange<Range>> void ParallelFor(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, F&& func);
+
+	template<typename It, typename T, typename BinaryOp = std::plus<>, typename = Detail::EnableIfNotSizedRange<It>> T ParallelReduce(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, T init, BinaryOp op = {});
+	template<typename Range, typename T, typename BinaryOp = std::plus<>, typename = Detail::EnableIfSizedRange<Range>> T ParallelReduce(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, T init, BinaryOp op = {});
+	template<typename It, typename T, typename ReduceOp, typename CombineOp, typename = Detail::EnableIfNotSizedRange<It>> T ParallelReduce(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, T init, T identity, ReduceOp reduceOp, CombineOp combineOp);
+	template<typename Range, typename T, typename ReduceOp, typename CombineOp, typename = Detail::EnableIfSizedRange<Range>> T ParallelReduce(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, T init, T identity, ReduceOp reduceOp, CombineOp combineOp);
+
+	template<typename It, typename Compare = std::less<>, typename = Detail::EnableIfNotSizedRange<It>> void ParallelSort(TaskScheduler& scheduler, It first, std::size_t count, Compare compare = {});
+	template<typename Range, typename Compare = std::less<>, typename = Detail::EnableIfSizedRange<Range>> void ParallelSort(TaskScheduler& scheduler, Range&& range, Compare compare = {});
+
+	template<typename InputIt, typename OutputIt, typename F, typename = Detail::EnableIfNotSizedRange<InputIt>> void ParallelTransform(TaskScheduler& scheduler, InputIt first, std::size_t count, OutputIt output, std::size_t grainSize, F&& func);
+	template<typename Range, typename OutputIt, typename F, typename = Detail::EnableIfSizedRange<Range>> void ParallelTransform(TaskScheduler& scheduler, Range&& range, OutputIt output, std::size_t grainSize, F&& func);
+}
+
+#include <NazaraUtils/ParallelAlgorithm.inl>
+
+#endif // NAZARAUTILS_PARALLELALGORITHM_HPP
@@ -0,0 +1,336 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		inline std::size_t ComputeGrainSize(const TaskScheduler& scheduler, std::size_t count, std::size_t grainSize)
+		{
+			if (grainSize > 0)
+				return grainSize;
+
+			// Automatic grain size: a few chunks per worker so that stealing can balance uneven chunks
+			std::size_t chunkCount = scheduler.GetWorkerCount() * 8;
+			return std::max<std::size_t>((count + chunkCount - 1) / chunkCount, 1);
+		}
+
+		// Calls chunkFunc for every chunk index, ranges of chunks are split in halves recursively so that tasks are spawned by the workers themselves
+		template<typename F>
+		void ParallelForChunks(TaskScheduler& scheduler, std::size_t chunkCount, F& chunkFunc)
+		{
+			if (chunkCount == 0)
+				return;
+
+			if (chunkCount == 1)
+			{
+				chunkFunc(std::size_t(0));
+				return;
+			}
+
+			TaskScheduler::Counter counter;
+			auto ProcessChunks = [&](auto& self, std::size_t firstChunk, std::size_t lastChunk) -> void
+			{
+				while (lastChunk - firstChunk > 1)
+				{
+					std::size_t middleChunk = firstChunk + (lastChunk - firstChunk) / 2;
+					scheduler.AddTask([&self, middleChunk, lastChunk] { self(self, middleChunk, lastChunk); }, &counter);
+					lastChunk = middleChunk;
+				}
+
+				chunkFunc(firstChunk);
+			};
+
+			ProcessChunks(ProcessChunks, 0, chunkCount);
+			scheduler.WaitFor(counter);
+		}
+
+		// Reduces every chunk in parallel using chunkFunc(first, last), and combines the chunk results in order starting from init
+		template<typename T, typename CombineOp, typename F>
+		T ParallelReduceChunks(TaskScheduler& scheduler, std::size_t count, std::size_t grainSize, T init, CombineOp& combineOp, F& chunkFunc)
+		{
+			if (count == 0)
+				return init;
+
+			grainSize = ComputeGrainSize(scheduler, count, grainSize);
+			std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+			std::vector<std::optional<T>> partialResults(chunkCount);
+			auto reduceFunc = [&](std::size_t chunkIndex)
+			{
+				std::size_t chunkFirst = chunkIndex * grainSize;
+				std::size_t chunkLast = std::min(chunkFirst + grainSize, count);
+
+				partialResults[chunkIndex].emplace(chunkFunc(chunkFirst, chunkLast));
+			};
+
+			ParallelForChunks(scheduler, chunkCount, reduceFunc);
+
+			for (std::optional<T>& partialResult : partialResults)
+				init = combineOp(std::move(init), std::move(*partialResult));
+
+			return init;
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every index in [0, count) in parallel
+	*
+	* The range is split in chunks of grainSize indices, each chunk being processed sequentially by a task of the scheduler.
+	* The calling thread takes part in the work and returns once every index has been processed.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param count Number of indices
+	* \param grainSize Number of indices per chunk, zero to split the range in a few chunks per worker
+	* \param func Function called with each index (std::size_t)
+	*
+	* \remark func must not throw
+	*/
+	template<typename F>
+	void ParallelFor(TaskScheduler& scheduler, std::size_t count, std::size_t grainSize, F&& func)
+	{
+		grainSize = Detail::ComputeGrainSize(scheduler, count, grainSize);
+
+		auto chunkFunc = [&](std::size_t chunkIndex)
+		{
+			std::size_t first = chunkIndex * grainSize;
+			std::size_t last = std::min(first + grainSize, count);
+			for (std::size_t i = first; i < last; ++i)
+				func(i);
+		};
+
+		Detail::ParallelForChunks(scheduler, (count + grainSize - 1) / grainSize, chunkFunc);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every element of a random-access range (such as a pointer or a SparsePtr) in parallel
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param first Iterator to the first element
+	* \param count Number of elements
+	* \param grainSize Number of elements per chunk, zero to split the range in a few chunks per worker
+	* \param func Function called with a reference to each element, or with its index and a reference to it (std::size_t, T&)
+	*
+	* \remark func must not throw
+	*/
+	template<typename It, typename F, typename>
+	void ParallelFor(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, F&& func)
+	{
+		ParallelFor(scheduler, count, grainSize, [&](std::size_t index)
+		{
+			if constexpr (std::is_invocable_v<F&, std::size_t, decltype(first[index])>)
+				func(index, first[index]);
+			else
+				func(first[index]);
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Calls a function for every element of a container (FixedVector, StackArray, std::vector, C array, ...) in parallel
+	*
+	* \see ParallelFor
+	*/
+	template<typename Range, typename F, typename>
+	void ParallelFor(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, F&& func)
+	{
+		ParallelFor(scheduler, std::begin(range), std::size(range), grainSize, std::forward<F>(func));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reduces a random-access range in parallel
+	* \return Result of the reduction, init if the range is empty
+	*
+	* Each chunk is reduced sequentially starting from its first element, chunk results are then reduced in order starting from init.
+	* As op is used both to accumulate elements and to combine chunk results, it must take two T (elements being converted to T).
+	* The operation must be associative but does not need to be commutative.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param first Iterator to the first element
+	* \param count Number of elements
+	* \param grainSize Number of elements per chunk, zero to split the range in a few chunks per worker
+	* \param init Initial value
+	* \param op Binary operation taking two T and returning a T
+	*
+	* \see ParallelReduce with a separate combine operation, for operations taking an accumulated value and an element
+	*/
+	template<typename It, typename T, typename BinaryOp, typename>
+	T ParallelReduce(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, T init, BinaryOp op)
+	{
+		static_assert(std::is_convertible_v<decltype(first[0]), T>, "elements must be convertible to T, use the ParallelReduce overload taking a combine operation");
+		static_assert(std::is_invocable_r_v<T, BinaryOp&, T, T>, "op must take two T, use the ParallelReduce overload taking a combine operation");
+
+		auto chunkFunc = [&](std::size_t chunkFirst, std::size_t chunkLast)
+		{
+			T result = static_cast<T>(first[chunkFirst]);
+			for (std::size_t i = chunkFirst + 1; i < chunkLast; ++i)
+				result = op(std::move(result), static_cast<T>(first[i]));
+
+			return result;
+		};
+
+		return Detail::ParallelReduceChunks(scheduler, count, grainSize, std::move(init), op, chunkFunc);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reduces a container in parallel
+	*
+	* \see ParallelReduce
+	*/
+	template<typename Range, typename T, typename BinaryOp, typename>
+	T ParallelReduce(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, T init, BinaryOp op)
+	{
+		return ParallelReduce(scheduler, std::begin(range), std::size(range), grainSize, std::move(init), std::move(op));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reduces a random-access range in parallel, using a separate operation to combine chunk results
+	* \return Result of the reduction, init if the range is empty
+	*
+	* Each chunk is reduced sequentially by applying reduceOp to every element, starting from a copy of identity.
+	* Chunk results are then combined in order using combineOp, starting from init.
+	* This allows operations accumulating elements of another type, such as a sum of squares or a count of matching elements.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param first Iterator to the first element
+	* \param count Number of elements
+	* \param grainSize Number of elements per chunk, zero to split the range in a few chunks per worker
+	* \param init Initial value
+	* \param identity Identity value of combineOp (such as 0 for a sum or 1 for a product), used to start the reduction of every chunk
+	* \param reduceOp Binary operation taking a T and an element, and returning a T
+	* \param combineOp Associative binary operation taking two T and returning a T
+	*/
+	template<typename It, typename T, typename ReduceOp, typename CombineOp, typename>
+	T ParallelReduce(TaskScheduler& scheduler, It first, std::size_t count, std::size_t grainSize, T init, T identity, ReduceOp reduceOp, CombineOp combineOp)
+	{
+		auto chunkFunc = [&](std::size_t chunkFirst, std::size_t chunkLast)
+		{
+			T result = identity;
+			for (std::size_t i = chunkFirst; i < chunkLast; ++i)
+				result = reduceOp(std::move(result), first[i]);
+
+			return result;
+		};
+
+		return Detail::ParallelReduceChunks(scheduler, count, grainSize, std::move(init), combineOp, chunkFunc);
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Reduces a container in parallel, using a separate operation to combine chunk results
+	*
+	* \see ParallelReduce
+	*/
+	template<typename Range, typename T, typename ReduceOp, typename CombineOp, typename>
+	T ParallelReduce(TaskScheduler& scheduler, Range&& range, std::size_t grainSize, T init, T identity, ReduceOp reduceOp, CombineOp combineOp)
+	{
+		return ParallelReduce(scheduler, std::begin(range), std::size(range), grainSize, std::move(init), std::move(identity), std::move(reduceOp), std::move(combineOp));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Sorts a random-access range in parallel (merge sort)
+	*
+	* The range is split in a power-of-two number of chunks which are sorted in parallel, and then merged pairwise in parallel.
+	* Small ranges are sorted directly by std::sort. The sort is not stable.
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param first Iterator to the first element, must satisfy std::sort requirements
+	* \param count Number of elements
+	* \param compare Comparison function object
+	*/
+	template<typename It, typename Compare, typename>
+	void ParallelSort(TaskScheduler& scheduler, It first, std::size_t count, Compare compare)
+	{
+		constexpr std::size_t MinChunkSize = 4096;
+
+		std::size_t chunkCount = RoundToPow2(scheduler.GetWorkerCount() * 2);
+		while (chunkCount > 1 && count / chunkCount < MinChunkSize)
+			chunkCount /= 2;
+
+		if (chunkCount <= 1)
+		{
+			std::sort(first, first + count, compare);
+			return;
+		}
+
+		auto ChunkBegin = [&](std::size_t chunkIndex)
+		{
+			return first + count * chunkIndex / chunkCount;
+		};
+
+		auto sortFunc = [&](std::size_t chunkIndex)
+		{
+			std::sort(ChunkBegin(chunkIndex), ChunkBegin(chunkIndex + 1), compare);
+		};
+		Detail::ParallelForChunks(scheduler, chunkCount, sortFunc);
+
+		for (std::size_t width = 1; width < chunkCount; width *= 2)
+		{
+			auto mergeFunc = [&](std::size_t pairIndex)
+			{
+				std::size_t firstChunk = pairIndex * width * 2;
+				std::inplace_merge(ChunkBegin(firstChunk), ChunkBegin(firstChunk + width), ChunkBegin(firstChunk + width * 2), compare);
+			};
+			Detail::ParallelForChunks(scheduler, chunkCount / (width * 2), mergeFunc);
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Sorts a container in parallel
+	*
+	* \see ParallelSort
+	*/
+	template<typename Range, typename Compare, typename>
+	void ParallelSort(TaskScheduler& scheduler, Range&& range, Compare compare)
+	{
+		ParallelSort(scheduler, std::begin(range), std::size(range), std::move(compare));
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Applies a function to every element of a random-access range in parallel, storing the results in another range
+	*
+	* \param scheduler Scheduler running the chunks
+	* \param first Iterator to the first input element
+	* \param count Number of elements
+	* \param output Random-access iterator to the first output element, the output range must hold count elements (and may be the input range)
+	* \param grainSize Number of elements per chunk, zero to split the range in a few chunks per worker
+	* \param func Function called with each input element, returning the output element
+	*
+	* \remark func must not throw
+	*/
+	template<typename InputIt, typename OutputIt, typename F, typename>
+	void ParallelTransform(TaskScheduler& scheduler, InputIt first, std::size_t count, OutputIt output, std::size_t grainSize, F&& func)
+	{
+		ParallelFor(scheduler, count, grainSize, [&](std::size_t index)
+		{
+			output[index] = func(first[index]);
+		});
+	}
+
+	/*!
+	* \ingroup utils
+	* \brief Applies a function to every element of a container in parallel, storing the results in another range
+	*
+	* \see ParallelTransform
+	*/
+	template<typename Range, typename OutputIt, typename F, typename>
+	void ParallelTransform(TaskScheduler& scheduler, Range&& range, OutputIt output, std::size_t grainSize, F&& func)
+	{
+		ParallelTransform(scheduler, std::begin(range), std::size(range), output, grainSize, std::forward<F>(func));
+	}
+}
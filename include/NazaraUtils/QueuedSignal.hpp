@@ -0,0 +1,87 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_QUEUEDSIGNAL_HPP
+#define NAZARAUTILS_QUEUEDSIGNAL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FlatMap.hpp>
+#include <NazaraUtils/LinearArena.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename... Args>
+	class QueuedSignal
+	{
+		public:
+			using Connection = typename Signal<Args...>::Connection;
+			using ConnectionGuard = typename Signal<Args...>::ConnectionGuard;
+
+			explicit QueuedSignal(std::size_t blockSize = DefaultBlockSize);
+			QueuedSignal(const QueuedSignal&) = delete;
+			QueuedSignal(QueuedSignal&&) = delete;
+			~QueuedSignal() = default;
+
+			void Clear();
+
+			template<typename... ConnectArgs> Connection Connect(ConnectArgs&&... args);
+
+			void DiscardEvents();
+
+			void EmitCoalesced(UInt64 key, Args... args);
+
+			std::size_t Flush();
+
+			std::size_t GetPendingEventCount() const;
+
+			void operator()(Args... args);
+
+			QueuedSignal& operator=(const QueuedSignal&) = delete;
+			QueuedSignal& operator=(QueuedSignal&&) = delete;
+
+			static constexpr std::size_t DefaultBlockSize = 16 * 1024;
+
+		private:
+			struct Event
+			{
+				Event(Args... eventArgs);
+
+				std::tuple<std::decay_t<Args>...> arguments;
+				Event* next = nullptr;
+			};
+
+			struct EventQueue
+			{
+				EventQueue(std::size_t blockSize);
+
+				void Push(Event* event);
+				void Reset();
+
+				FlatMap<UInt64, Event*, std::vector<UInt64>, std::vector<Event*>> coalescedEvents;
+				LinearArena arena;
+				Event* firstEvent = nullptr;
+				Event* lastEvent = nullptr;
+				std::size_t eventCount = 0;
+			};
+
+			std::array<EventQueue, 2> m_queues;
+			mutable std::mutex m_mutex;
+			std::size_t m_pendingQueueIndex;
+			Signal<Args...> m_signal;
+			bool m_isFlushing;
+	};
+}
+
+#include <NazaraUtils/QueuedSignal.inl>
+
+#endif // NAZARAUTILS_QUEUEDSIGNAL_HPP
@@ -0,0 +1,194 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::QueuedSignal
+	* \brief Signal whose emissions are queued and delivered in a batch by Flush
+	*
+	* Events can be emitted from any thread, their arguments are copied in a linear arena and delivered to the slots by the thread calling Flush (usually the main thread).
+	* Events emitted with a coalescing key replace the pending event with the same key (keeping its position in the queue), which is useful to only keep the last state of something per frame.
+	*
+	* Two queues are used alternatively: events emitted while flushing (including from slots) are delivered by the next Flush.
+	* Their memory is reused from one flush to another, emitting an event doesn't allocate once the arenas have grown enough.
+	*
+	* \remark Connecting and disconnecting slots is not thread-safe and should happen on the thread calling Flush
+	*/
+
+	/*!
+	* \brief Constructs a QueuedSignal object
+	*
+	* \param blockSize Size of the arena blocks storing event arguments
+	*/
+	template<typename... Args>
+	QueuedSignal<Args...>::QueuedSignal(std::size_t blockSize) :
+	m_queues{ { EventQueue(blockSize), EventQueue(blockSize) } },
+	m_pendingQueueIndex(0),
+	m_isFlushing(false)
+	{
+	}
+
+	/*!
+	* \brief Disconnects every slot of the signal
+	*
+	* \remark Pending events are kept
+	* \see DiscardEvents
+	*/
+	template<typename... Args>
+	void QueuedSignal<Args...>::Clear()
+	{
+		m_signal.Clear();
+	}
+
+	/*!
+	* \brief Connects a slot to the signal
+	* \return Connection attached to the signal
+	*
+	* \param args Arguments for Signal::Connect (function object, or object and member function)
+	*/
+	template<typename... Args>
+	template<typename... ConnectArgs>
+	auto QueuedSignal<Args...>::Connect(ConnectArgs&&... args) -> Connection
+	{
+		return m_signal.Connect(std::forward<ConnectArgs>(args)...);
+	}
+
+	/*!
+	* \brief Discards every pending event without delivering them
+	*/
+	template<typename... Args>
+	void QueuedSignal<Args...>::DiscardEvents()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queues[m_pendingQueueIndex].Reset();
+	}
+
+	/*!
+	* \brief Queues an event, replacing the pending event with the same key if any
+	*
+	* \param key Coalescing key of the event
+	* \param args Arguments of the event
+	*
+	* \remark This function is thread-safe
+	*/
+	template<typename... Args>
+	void QueuedSignal<Args...>::EmitCoalesced(UInt64 key, Args... args)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		EventQueue& queue = m_queues[m_pendingQueueIndex];
+		auto [it, inserted] = queue.coalescedEvents.try_emplace(key, nullptr);
+		if (inserted)
+		{
+			Event* event = queue.arena.template New<Event>(std::forward<Args>(args)...);
+			it->second = event;
+			queue.Push(event);
+		}
+		else
+			it->second->arguments = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Delivers every pending event to the slots, in the order they were emitted
+	* \return Number of delivered events
+	*
+	* \remark This function must not be called by multiple threads at once, nor from a slot
+	*/
+	template<typename... Args>
+	std::size_t QueuedSignal<Args...>::Flush()
+	{
+		NazaraAssertMsg(!m_isFlushing, "Flush is not reentrant");
+
+		EventQueue* queue;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			queue = &m_queues[m_pendingQueueIndex];
+			if (queue->eventCount == 0)
+				return 0;
+
+			// New events will go to the other queue while we deliver these ones
+			m_pendingQueueIndex ^= 1;
+		}
+
+		m_isFlushing = true;
+		NAZARA_DEFER({
+			queue->Reset();
+			m_isFlushing = false;
+		});
+
+		std::size_t eventCount = queue->eventCount;
+		for (Event* event = queue->firstEvent; event; event = event->next)
+			std::apply(m_signal, event->arguments);
+
+		return eventCount;
+	}
+
+	/*!
+	* \brief Gets the number of events waiting for the next Flush
+	* \return Pending event count
+	*/
+	template<typename... Args>
+	std::size_t QueuedSignal<Args...>::GetPendingEventCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_queues[m_pendingQueueIndex].eventCount;
+	}
+
+	/*!
+	* \brief Queues an event
+	*
+	* \param args Arguments of the event
+	*
+	* \remark This function is thread-safe
+	*/
+	template<typename... Args>
+	void QueuedSignal<Args...>::operator()(Args... args)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		EventQueue& queue = m_queues[m_pendingQueueIndex];
+		queue.Push(queue.arena.template New<Event>(std::forward<Args>(args)...));
+	}
+
+	template<typename... Args>
+	QueuedSignal<Args...>::Event::Event(Args... eventArgs) :
+	arguments(std::forward<Args>(eventArgs)...)
+	{
+	}
+
+	template<typename... Args>
+	QueuedSignal<Args...>::EventQueue::EventQueue(std::size_t blockSize) :
+	arena(blockSize)
+	{
+	}
+
+	template<typename... Args>
+	void QueuedSignal<Args...>::EventQueue::Push(Event* event)
+	{
+		if (lastEvent)
+			lastEvent->next = event;
+		else
+			firstEvent = event;
+
+		lastEvent = event;
+		eventCount++;
+	}
+
+	template<typename... Args>
+	void QueuedSignal<Args...>::EventQueue::Reset()
+	{
+		arena.Reset(); //< destroys events arguments but keeps memory blocks
+		coalescedEvents.clear();
+		firstEvent = nullptr;
+		lastEvent = nullptr;
+		eventCount = 0;
+	}
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SPSCQUEUE_HPP
+#define NAZARAUTILS_SPSCQUEUE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T, std::size_t Capacity>
+	class SPSCQueue
+	{
+		static_assert(Capacity > 0 && IsPow2(Capacity), "queue capacity must be a power of two");
+
+		public:
+			SPSCQueue();
+			SPSCQueue(const SPSCQueue&) = delete;
+			SPSCQueue(SPSCQueue&&) = delete;
+			~SPSCQueue();
+
+			std::size_t GetCapacity() const;
+
+			template<typename... Args> bool TryEmplace(Args&&... args);
+			bool TryPop(T& value);
+			template<typename OutputIt> std::size_t TryPopN(OutputIt output, std::size_t maxCount);
+			bool TryPush(const T& value);
+			bool TryPush(T&& value);
+			template<typename InputIt> std::size_t TryPushN(InputIt input, std::size_t count);
+
+			SPSCQueue& operator=(const SPSCQueue&) = delete;
+			SPSCQueue& operator=(SPSCQueue&&) = delete;
+
+		private:
+			T* GetElement(std::size_t index);
+
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			// Consumer data
+			alignas(CacheLineSize) std::atomic<std::size_t> m_head;
+			std::size_t m_cachedTail; //< last tail value read by the consumer
+
+			// Producer data
+			alignas(CacheLineSize) std::atomic<std::size_t> m_tail;
+			std::size_t m_cachedHead; //< last head value read by the producer
+
+			alignas(CacheLineSize) alignas(T) std::array<std::byte, sizeof(T) * Capacity> m_data;
+	};
+}
+
+#include <NazaraUtils/SPSCQueue.inl>
+
+#endif // NAZARAUTILS_SPSCQUEUE_HPP
@@ -0,0 +1,161 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class SPSCQueue
+	* \brief Wait-free bounded queue with inline storage, for one producer thread and one consumer thread
+	*
+	* Head and tail indices live on their own cache line, along with the last value of the other index seen by each side,
+	* so that the producer and the consumer only read each other's index when the queue looks full or empty.
+	*
+	* \remark TryPush/TryEmplace/TryPushN must only be called from the producer thread, TryPop/TryPopN from the consumer thread
+	*/
+
+	template<typename T, std::size_t Capacity>
+	SPSCQueue<T, Capacity>::SPSCQueue() :
+	m_head(0),
+	m_cachedTail(0),
+	m_tail(0),
+	m_cachedHead(0)
+	{
+	}
+
+	template<typename T, std::size_t Capacity>
+	SPSCQueue<T, Capacity>::~SPSCQueue()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			std::size_t tail = m_tail.load(std::memory_order_acquire);
+			for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+				PlacementDestroy(GetElement(i));
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	std::size_t SPSCQueue<T, Capacity>::GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	template<typename T, std::size_t Capacity>
+	template<typename... Args>
+	bool SPSCQueue<T, Capacity>::TryEmplace(Args&&... args)
+	{
+		std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead == Capacity)
+		{
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead == Capacity)
+				return false;
+		}
+
+		PlacementNew(GetElement(tail), std::forward<Args>(args)...);
+		m_tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SPSCQueue<T, Capacity>::TryPop(T& value)
+	{
+		std::size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail)
+		{
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail)
+				return false;
+		}
+
+		T* element = GetElement(head);
+		value = std::move(*element);
+		PlacementDestroy(element);
+
+		m_head.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Pops up to maxCount elements at once, publishing the freed slots to the producer only once
+	* \return Number of elements written to output
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename OutputIt>
+	std::size_t SPSCQueue<T, Capacity>::TryPopN(OutputIt output, std::size_t maxCount)
+	{
+		std::size_t head = m_head.load(std::memory_order_relaxed);
+		if (m_cachedTail - head < maxCount)
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+		std::size_t count = std::min(m_cachedTail - head, maxCount);
+		if (count == 0)
+			return 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			T* element = GetElement(head + i);
+			*output = std::move(*element);
+			++output;
+
+			PlacementDestroy(element);
+		}
+
+		m_head.store(head + count, std::memory_order_release);
+
+		return count;
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SPSCQueue<T, Capacity>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template<typename T, std::size_t Capacity>
+	bool SPSCQueue<T, Capacity>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	/*!
+	* \brief Pushes up to count elements at once, publishing them to the consumer only once
+	* \return Number of elements read from input (elements are copied unless input is a move iterator)
+	*/
+	template<typename T, std::size_t Capacity>
+	template<typename InputIt>
+	std::size_t SPSCQueue<T, Capacity>::TryPushN(InputIt input, std::size_t count)
+	{
+		std::size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (Capacity - (tail - m_cachedHead) < count)
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+
+		count = std::min(Capacity - (tail - m_cachedHead), count);
+		if (count == 0)
+			return 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			PlacementNew(GetElement(tail + i), *input);
+			++input;
+		}
+
+		m_tail.store(tail + count, std::memory_order_release);
+
+		return count;
+	}
+
+	template<typename T, std::size_t Capacity>
+	T* SPSCQueue<T, Capacity>::GetElement(std::size_t index)
+	{
+		return std::launder(reinterpret_cast<T*>(&m_data[(index & Mask) * sizeof(T)]));
+	}
+}
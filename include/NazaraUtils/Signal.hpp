@@ -7,9 +7,11 @@
 #ifndef NAZARAUTILS_SIGNAL_HPP
 #define NAZARAUTILS_SIGNAL_HPP
 
-#include <NazaraUtils/FixedVector.hpp>
-#include <functional>
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #define NazaraDetailSignal(Keyword, SignalName, ...) using SignalName ## Type = Nz::Signal<__VA_ARGS__>; \
@@ -28,19 +30,18 @@ namespace Nz
 	class Signal
 	{
 		public:
-			using Callback = std::function<void(Args...)>;
+			using Callback = InplaceFunction<void(Args...)>;
 			class Connection;
 			class ConnectionGuard;
 
-			Signal();
+			Signal() = default;
 			Signal(const Signal&);
 			Signal(Signal&& signal) noexcept;
-			~Signal() = default;
+			~Signal();
 
 			void Clear();
 
-			Connection Connect(const Callback& func);
-			Connection Connect(Callback&& func);
+			template<typename F, typename = std::enable_if_t<std::is_invocable_v<std::decay_t<F>&, Args...>>> Connection Connect(F&& func);
 			template<typename O> Connection Connect(O& object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(O* object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(const O& object, void (O::*method)(Args...) const);
@@ -52,28 +53,40 @@ namespace Nz
 			Signal& operator=(Signal&& signal) noexcept;
 
 		private:
-			struct Slot;
+			struct SlotPool;
 
-			using SlotPtr = std::shared_ptr<Slot>;
-			using SlotList = HybridVector<SlotPtr, 1>;
-			using SlotListIndex = typename SlotList::size_type;
-
-			struct Slot
-			{
-				Slot(Signal* me) :
-				signal(me)
-				{
-				}
-
-				Callback callback;
-				Signal* signal;
-				SlotListIndex index;
-			};
-
-			void Disconnect(const SlotPtr& slot) noexcept;
+			std::shared_ptr<SlotPool> m_slotPool;
+	};
 
-			SlotList m_slots;
-			mutable SlotListIndex m_slotIterator;
+	template<typename... Args>
+	struct Signal<Args...>::SlotPool
+	{
+		static constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+
+		struct Handle
+		{
+			UInt32 generation;
+			UInt32 slotIndex; //< index of the next free handle if this one is free
+		};
+
+		struct Slot
+		{
+			Callback callback;
+			UInt32 handleIndex; //< InvalidIndex if the slot was disconnected while emitting
+		};
+
+		UInt32 AllocateHandle(UInt32 slotIndex);
+		void ApplyPendingChanges();
+		void Clear();
+		void Disconnect(UInt32 handleIndex);
+		void FreeHandle(UInt32 handleIndex);
+
+		std::vector<Handle> handles;
+		std::vector<Slot> pendingSlots;
+		std::vector<Slot> slots;
+		UInt32 emitDepth = 0;
+		UInt32 freeHandle = InvalidIndex;
+		bool hasPendingChanges = false;
 	};
 
 	template<typename... Args>
@@ -98,9 +111,11 @@ namespace Nz
 			Connection& operator=(Connection&& connection) noexcept;
 
 		private:
-			Connection(const SlotPtr& slot);
+			Connection(std::shared_ptr<SlotPool> slotPool, UInt32 handleIndex, UInt32 generation);
 
-			std::weak_ptr<Slot> m_ptr;
+			std::shared_ptr<SlotPool> m_slotPool;
+			UInt32 m_generation = 0;
+			UInt32 m_handleIndex = 0;
 	};
 
 	template<typename... Args>
@@ -2,7 +2,10 @@
 // This file is part of the "Nazara Utility Library"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
-#include <cassert>
+#include <NazaraUtils/Assert.hpp>
+#include <NazaraUtils/CallOnExit.hpp>
+#include <cstddef>
+#include <initializer_list>
 #include <utility>
 
 namespace Nz
@@ -11,17 +14,14 @@ namespace Nz
 	* \ingroup utils
 	* \class Nz::Signal
 	* \brief Core class that represents a signal, a list of objects waiting for its message
+	*
+	* Slots are stored by value in a contiguous pool shared with their connections, which reference them by a generational index.
+	* Callbacks are stored inline (callables too big for Callback are moved to the heap), connecting only allocates when the pool grows.
+	*
+	* Slots can be connected and disconnected from a callback: disconnected slots are not called anymore (but are only destroyed once the signal emission is over),
+	* slots connected while emitting will be called starting with the next emission.
 	*/
 
-	/*!
-	* \brief Constructs a Signal object by default
-	*/
-	template<typename... Args>
-	Signal<Args...>::Signal() :
-	m_slotIterator(0)
-	{
-	}
-
 	/*!
 	* \brief Constructs a Signal object by default
 	*
@@ -40,61 +40,76 @@ namespace Nz
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Signal(Signal&& signal) noexcept
+	Signal<Args...>::Signal(Signal&& signal) noexcept :
+	m_slotPool(std::move(signal.m_slotPool))
 	{
-		operator=(std::move(signal));
 	}
 
 	/*!
-	* \brief Clears the list of actions attached to the signal
+	* \brief Destructs the signal and disconnects its slots
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Clear()
+	Signal<Args...>::~Signal()
 	{
-		m_slots.clear();
-		m_slotIterator = 0;
+		if (m_slotPool)
+			m_slotPool->Clear();
 	}
 
 	/*!
-	* \brief Connects a function to the signal
-	* \return Connection attached to the signal
-	*
-	* \param func Non-member function
+	* \brief Clears the list of actions attached to the signal
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(const Callback& func)
+	void Signal<Args...>::Clear()
 	{
-		return Connect(Callback(func));
+		if (m_slotPool)
+			m_slotPool->Clear();
 	}
 
 	/*!
 	* \brief Connects a function to the signal
 	* \return Connection attached to the signal
 	*
-	* \param func Non-member function
+	* \param func Function object (non-member function, lambda, Callback, ...)
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(Callback&& func)
+	template<typename F, typename>
+	typename Signal<Args...>::Connection Signal<Args...>::Connect(F&& func)
 	{
-		assert((func) &&  "Invalid function");
+		using Functor = std::decay_t<F>;
+
+		if constexpr (std::is_same_v<Functor, Callback> || std::is_pointer_v<std::remove_reference_t<F>>)
+		{
+			NazaraAssertMsg(func, "invalid function");
+		}
+
+		if (!m_slotPool)
+			m_slotPool = std::make_shared<SlotPool>();
 
-		// Since we're incrementing the slot vector size, we need to replace our iterator at the end
-		// (Except when we are iterating on the signal)
-		bool resetIt = (m_slotIterator >= m_slots.size());
+		SlotPool& slotPool = *m_slotPool;
 
-		auto tempPtr = std::make_shared<Slot>(this);
-		tempPtr->callback = std::move(func);
-		tempPtr->index = m_slots.size();
+		// Connecting while emitting could reallocate the slot being called, the slot will be inserted at the end of the emission
+		// (pending slots are indexed after the active ones)
+		bool isEmitting = (slotPool.emitDepth > 0);
+		std::vector<typename SlotPool::Slot>& slotList = (isEmitting) ? slotPool.pendingSlots : slotPool.slots;
+		UInt32 slotIndex = static_cast<UInt32>((isEmitting) ? slotPool.slots.size() + slotPool.pendingSlots.size() : slotPool.slots.size());
+		if (isEmitting)
+			slotPool.hasPendingChanges = true;
 
-		m_slots.emplace_back(std::move(tempPtr));
+		UInt32 handleIndex = slotPool.AllocateHandle(slotIndex);
 
-		if (resetIt)
-			m_slotIterator = m_slots.size(); //< Replace the iterator to the end
+		constexpr bool IsStoredInline = std::is_same_v<Functor, Callback> || (sizeof(Functor) <= Callback::StorageCapacity && alignof(Functor) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Functor>);
+		if constexpr (IsStoredInline)
+			slotList.push_back({ Callback(std::forward<F>(func)), handleIndex });
+		else
+		{
+			// Callable is too big (or not nothrow movable) to be stored inline
+			slotList.push_back({ Callback([functor = std::make_unique<Functor>(std::forward<F>(func))](Args... args) { (*functor)(std::forward<Args>(args)...); }), handleIndex });
+		}
 
-		return Connection(m_slots.back());
+		return Connection(m_slotPool, handleIndex, slotPool.handles[handleIndex].generation);
 	}
 
 	/*!
@@ -178,8 +193,25 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::operator()(Args... args) const
 	{
-		for (m_slotIterator = 0; m_slotIterator < m_slots.size(); ++m_slotIterator)
-			m_slots[m_slotIterator]->callback(args...);
+		if (!m_slotPool)
+			return;
+
+		SlotPool& slotPool = *m_slotPool;
+
+		slotPool.emitDepth++;
+		NAZARA_DEFER({
+			if (--slotPool.emitDepth == 0 && slotPool.hasPendingChanges)
+				slotPool.ApplyPendingChanges();
+		});
+
+		// Slots are neither added nor removed from this list while emitting
+		std::size_t slotCount = slotPool.slots.size();
+		for (std::size_t i = 0; i < slotCount; ++i)
+		{
+			typename SlotPool::Slot& slot = slotPool.slots[i];
+			if (slot.handleIndex != SlotPool::InvalidIndex)
+				slot.callback(args...);
+		}
 	}
 
 	/*!
@@ -199,65 +231,152 @@ namespace Nz
 	* \return A reference to this
 	*
 	* \param signal Signal to move in this
+	*
+	* \remark Slots of this signal are disconnected, connections of the moved signal stay valid
 	*/
 	template<typename... Args>
 	Signal<Args...>& Signal<Args...>::operator=(Signal&& signal) noexcept
 	{
-		m_slots = std::move(signal.m_slots);
-		m_slotIterator = signal.m_slotIterator;
+		if (this == &signal)
+			return *this;
 
-		// We need to update the signal pointer inside of each slot
-		for (SlotPtr& slot : m_slots)
-			slot->signal = this;
+		if (m_slotPool)
+			m_slotPool->Clear();
+
+		m_slotPool = std::move(signal.m_slotPool);
 
 		return *this;
 	}
 
-	/*!
-	* \brief Disconnects a listener from this signal
-	*
-	* \param slot Pointer to the ith listener of the signal
-	*
-	* \remark Produces a NazaraAssert if slot is invalid (nullptr)
-	* \remark Produces a NazaraAssert if index of slot is invalid
-	* \remark Produces a NazaraAssert if slot is not attached to this signal
-	*/
+	template<typename... Args>
+	UInt32 Signal<Args...>::SlotPool::AllocateHandle(UInt32 slotIndex)
+	{
+		UInt32 handleIndex;
+		if (freeHandle != InvalidIndex)
+		{
+			handleIndex = freeHandle;
+			freeHandle = handles[handleIndex].slotIndex;
+		}
+		else
+		{
+			handleIndex = static_cast<UInt32>(handles.size());
+			handles.push_back({ 0, InvalidIndex });
+		}
+
+		handles[handleIndex].slotIndex = slotIndex;
+		return handleIndex;
+	}
 
 	template<typename... Args>
-	void Signal<Args...>::Disconnect(const SlotPtr& slot) noexcept
+	void Signal<Args...>::SlotPool::ApplyPendingChanges()
 	{
-		assert((slot) &&  "Invalid slot pointer");
-		assert((slot->index < m_slots.size()) &&  "Invalid slot index");
-		assert((slot->signal == this) &&  "Slot is not attached to this signal");
+		NazaraAssert(emitDepth == 0);
 
-		// "Swap this slot with the last one and pop" idiom
-		// This will preserve slot indexes
+		// Disconnected slots are only destroyed once the pool is consistent again, in case a callback destructor touches the signal
+		std::vector<Slot> disconnectedSlots;
 
-		// Can we safely "remove" this slot?
-		if (m_slotIterator >= (m_slots.size() - 1) || slot->index > m_slotIterator)
+		// Remove slots disconnected while emitting ("swap with the last one and pop" idiom)
+		for (std::size_t i = 0; i < slots.size();)
 		{
-			// Yes we can
-			SlotPtr& newSlot = m_slots[slot->index];
-			newSlot = std::move(m_slots.back());
-			newSlot->index = slot->index; //< Update the moved slot index before resizing (in case it's the last one)
+			if (slots[i].handleIndex == InvalidIndex)
+			{
+				disconnectedSlots.push_back(std::move(slots[i]));
+				if (i != slots.size() - 1)
+					slots[i] = std::move(slots.back());
+
+				slots.pop_back();
+			}
+			else
+			{
+				handles[slots[i].handleIndex].slotIndex = static_cast<UInt32>(i);
+				++i;
+			}
 		}
-		else
+
+		for (Slot& slot : pendingSlots)
+		{
+			if (slot.handleIndex == InvalidIndex)
+			{
+				disconnectedSlots.push_back(std::move(slot));
+				continue;
+			}
+
+			handles[slot.handleIndex].slotIndex = static_cast<UInt32>(slots.size());
+			slots.push_back(std::move(slot));
+		}
+
+		pendingSlots.clear(); //< only moved-from slots
+		hasPendingChanges = false;
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::SlotPool::Clear()
+	{
+		for (std::vector<Slot>* slotList : { &slots, &pendingSlots })
 		{
-			// Nope, let's be tricky
-			SlotPtr& current = m_slots[m_slotIterator];
-			SlotPtr& newSlot = m_slots[slot->index];
+			for (Slot& slot : *slotList)
+			{
+				if (slot.handleIndex != InvalidIndex)
+				{
+					FreeHandle(slot.handleIndex);
+					slot.handleIndex = InvalidIndex;
+				}
+			}
+		}
+
+		if (emitDepth > 0)
+		{
+			// Slots may be running, they will be destroyed at the end of the emission
+			hasPendingChanges = true;
+			return;
+		}
+
+		// Move slots out of the pool before destroying them, in case a callback destructor touches the signal
+		std::vector<Slot> oldSlots = std::move(slots);
+		std::vector<Slot> oldPendingSlots = std::move(pendingSlots);
+		slots.clear();
+		pendingSlots.clear();
+		hasPendingChanges = false;
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::SlotPool::Disconnect(UInt32 handleIndex)
+	{
+		UInt32 slotIndex = handles[handleIndex].slotIndex;
+		FreeHandle(handleIndex);
 
-			newSlot = std::move(current);
-			newSlot->index = slot->index; //< Update the moved slot index
+		if (emitDepth > 0)
+		{
+			// The slot may be running, disable it and remove it at the end of the emission
+			if (slotIndex < slots.size())
+				slots[slotIndex].handleIndex = InvalidIndex;
+			else
+				pendingSlots[slotIndex - slots.size()].handleIndex = InvalidIndex;
+
+			hasPendingChanges = true;
+			return;
+		}
 
-			current = std::move(m_slots.back());
-			current->index = m_slotIterator; //< Update the moved slot index
+		NazaraAssert(slotIndex < slots.size());
 
-			--m_slotIterator;
+		// "Swap this slot with the last one and pop" idiom
+		Slot oldSlot = std::move(slots[slotIndex]);
+		if (slotIndex != slots.size() - 1)
+		{
+			slots[slotIndex] = std::move(slots.back());
+			handles[slots[slotIndex].handleIndex].slotIndex = slotIndex;
 		}
 
-		// Pop the last entry (from where we moved our slot)
-		m_slots.pop_back();
+		slots.pop_back();
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::SlotPool::FreeHandle(UInt32 handleIndex)
+	{
+		Handle& handle = handles[handleIndex];
+		handle.generation++; //< invalidates connections to this slot
+		handle.slotIndex = freeHandle;
+		freeHandle = handleIndex;
 	}
 
 	/*!
@@ -272,20 +391,25 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Connection::Connection(Connection&& connection) noexcept :
-	m_ptr(std::move(connection.m_ptr))
+	m_slotPool(std::move(connection.m_slotPool)),
+	m_generation(connection.m_generation),
+	m_handleIndex(connection.m_handleIndex)
 	{
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
 	}
 	
 	/*!
-	* \brief Constructs a Signal::Connection object with a slot
+	* \brief Constructs a Signal::Connection object referencing a slot
 	*
-	* \param slot Slot of the listener
+	* \param slotPool Slot pool of the signal
+	* \param handleIndex Index of the slot handle
+	* \param generation Generation of the slot handle
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Connection::Connection(const SlotPtr& slot) :
-	m_ptr(slot)
+	Signal<Args...>::Connection::Connection(std::shared_ptr<SlotPool> slotPool, UInt32 handleIndex, UInt32 generation) :
+	m_slotPool(std::move(slotPool)),
+	m_generation(generation),
+	m_handleIndex(handleIndex)
 	{
 	}
 
@@ -310,8 +434,10 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::Connection::Disconnect() noexcept
 	{
-		if (SlotPtr ptr = m_ptr.lock())
-			ptr->signal->Disconnect(ptr);
+		if (IsConnected())
+			m_slotPool->Disconnect(m_handleIndex);
+
+		m_slotPool.reset();
 	}
 
 	/*!
@@ -322,7 +448,7 @@ namespace Nz
 	template<typename... Args>
 	bool Signal<Args...>::Connection::IsConnected() const
 	{
-		return !m_ptr.expired();
+		return m_slotPool && m_slotPool->handles[m_handleIndex].generation == m_generation;
 	}
 
 	/*!
@@ -333,8 +459,9 @@ namespace Nz
 	template<typename... Args>
 	typename Signal<Args...>::Connection& Signal<Args...>::Connection::operator=(Connection&& connection) noexcept
 	{
-		m_ptr = std::move(connection.m_ptr);
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		m_slotPool = std::move(connection.m_slotPool);
+		m_generation = connection.m_generation;
+		m_handleIndex = connection.m_handleIndex;
 
 		return *this;
 	}
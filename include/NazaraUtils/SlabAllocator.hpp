@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SLABALLOCATOR_HPP
+#define NAZARAUTILS_SLABALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/MovablePtr.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class SlabAllocator
+	{
+		public:
+			static constexpr std::size_t MinSizeClass = 8;
+			static constexpr std::size_t MaxSizeClass = 2048;
+			static constexpr std::size_t SizeClassCount = 25;
+
+			explicit SlabAllocator(std::size_t slabSize = 64 * 1024);
+			SlabAllocator(const SlabAllocator&) = delete;
+			SlabAllocator(SlabAllocator&&) noexcept = default;
+			~SlabAllocator();
+
+			void* Allocate(std::size_t size);
+
+			void Clear();
+
+			void Free(void* ptr, std::size_t size);
+
+			std::size_t GetAllocatedEntryCount() const;
+			std::size_t GetSlabCount() const;
+			std::size_t GetSlabSize() const;
+
+			std::size_t ReleaseEmptySlabs();
+
+			SlabAllocator& operator=(const SlabAllocator&) = delete;
+			SlabAllocator& operator=(SlabAllocator&& allocator) noexcept;
+
+			static constexpr std::size_t GetSizeClassIndex(std::size_t size);
+			static constexpr std::size_t GetSizeClassSize(std::size_t sizeClassIndex);
+
+		private:
+			struct Slab;
+
+			Slab* AllocateSlab(std::size_t sizeClassIndex);
+			void FreeSlab(Slab* slab);
+			Slab* GetSlab(const void* ptr) const;
+			void LinkPartialSlab(Slab* slab);
+			void UnlinkPartialSlab(Slab* slab);
+
+			static constexpr std::size_t GetSlabHeaderSize();
+
+			struct Slab
+			{
+				Bitset<UInt64> freeEntries;
+				std::byte* entries;
+				std::size_t firstFreeBlockHint;
+				std::size_t freeEntryCount;
+				std::size_t sizeClassIndex;
+				Slab* previousPartial;
+				Slab* nextPartial;
+			};
+
+			struct SizeClass
+			{
+				std::size_t allocatedEntryCount = 0;
+				std::size_t entryCountPerSlab = 0;
+				std::vector<Slab*> slabs;
+				MovablePtr<Slab> partialSlabs; //< slabs having at least one free entry
+			};
+
+			std::array<SizeClass, SizeClassCount> m_sizeClasses;
+			std::size_t m_slabSize;
+	};
+}
+
+#include <NazaraUtils/SlabAllocator.inl>
+
+#endif // NAZARAUTILS_SLABALLOCATOR_HPP
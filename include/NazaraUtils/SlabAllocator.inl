@@ -0,0 +1,322 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SlabAllocator
+	* \brief Allocator for small objects of heterogeneous sizes, sorting allocations in size classes each backed by slabs
+	*
+	* Size classes follow jemalloc spacing: 8, 16, 32, 48, 64 and then four classes per power of two (80, 96, 112, 128, 160, ...) up to MaxSizeClass,
+	* which keeps internal fragmentation under 25%.
+	* Each slab is a block of slab size bytes (aligned to its size) holding entries of a single size class, whose occupancy is tracked by a bitset,
+	* this allows Free to retrieve the slab of an allocation by masking its address.
+	* Allocations bigger than MaxSizeClass are forwarded to the global operator new.
+	*
+	* \remark Allocations are aligned to min(size class, alignof(std::max_align_t))
+	* \remark This allocator is not thread-safe
+	*/
+
+	/*!
+	* \brief Constructs a SlabAllocator object
+	*
+	* \param slabSize Size of slabs in bytes, must be a power of two big enough to hold at least one entry of MaxSizeClass
+	*/
+	inline SlabAllocator::SlabAllocator(std::size_t slabSize) :
+	m_slabSize(slabSize)
+	{
+		assert(IsPow2(slabSize));
+		assert(slabSize >= GetSlabHeaderSize() + MaxSizeClass);
+
+		for (std::size_t sizeClassIndex = 0; sizeClassIndex < SizeClassCount; ++sizeClassIndex)
+			m_sizeClasses[sizeClassIndex].entryCountPerSlab = (m_slabSize - GetSlabHeaderSize()) / GetSizeClassSize(sizeClassIndex);
+	}
+
+	inline SlabAllocator::~SlabAllocator()
+	{
+		Clear();
+	}
+
+	/*!
+	* \brief Allocates memory
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the allocation in bytes, it will be rounded up to its size class
+	*/
+	inline void* SlabAllocator::Allocate(std::size_t size)
+	{
+		if (size > MaxSizeClass)
+			return ::operator new(size);
+
+		std::size_t sizeClassIndex = GetSizeClassIndex(size);
+		SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+
+		Slab* slab = sizeClass.partialSlabs;
+		if (!slab)
+			slab = AllocateSlab(sizeClassIndex);
+
+		assert(slab->freeEntryCount > 0);
+
+		// Every block before the hint is known to be full
+		std::size_t blockIndex = slab->firstFreeBlockHint;
+		UInt64 block;
+		while ((block = slab->freeEntries.GetBlock(blockIndex)) == 0)
+			blockIndex++;
+
+		slab->freeEntries.SetBlock(blockIndex, block & (block - 1)); //< clear lowest set bit
+		slab->firstFreeBlockHint = blockIndex;
+
+		if (--slab->freeEntryCount == 0)
+			UnlinkPartialSlab(slab);
+
+		sizeClass.allocatedEntryCount++;
+
+		std::size_t entryIndex = blockIndex * Bitset<UInt64>::bitsPerBlock + FindFirstBit(block) - 1;
+		return slab->entries + entryIndex * GetSizeClassSize(sizeClassIndex);
+	}
+
+	/*!
+	* \brief Releases every slab
+	*
+	* \remark This invalidates every allocation made from this allocator (except those bigger than MaxSizeClass)
+	*/
+	inline void SlabAllocator::Clear()
+	{
+		for (SizeClass& sizeClass : m_sizeClasses)
+		{
+			for (Slab* slab : sizeClass.slabs)
+				FreeSlab(slab);
+
+			sizeClass.allocatedEntryCount = 0;
+			sizeClass.partialSlabs = nullptr;
+			sizeClass.slabs.clear();
+		}
+	}
+
+	/*!
+	* \brief Frees memory allocated with Allocate
+	*
+	* \param ptr Pointer returned by Allocate
+	* \param size Size which was passed to Allocate
+	*
+	* \remark The size is used to retrieve the size class directly, without having to read it from the slab
+	*/
+	inline void SlabAllocator::Free(void* ptr, std::size_t size)
+	{
+		if (size > MaxSizeClass)
+			return ::operator delete(ptr);
+
+		std::size_t sizeClassIndex = GetSizeClassIndex(size);
+		SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+
+		Slab* slab = GetSlab(ptr);
+		assert(slab->sizeClassIndex == sizeClassIndex);
+
+		std::size_t entryIndex = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - slab->entries) / GetSizeClassSize(sizeClassIndex);
+		assert(!slab->freeEntries.Test(entryIndex));
+
+		slab->freeEntries.Set(entryIndex);
+		slab->firstFreeBlockHint = std::min(slab->firstFreeBlockHint, entryIndex / Bitset<UInt64>::bitsPerBlock);
+
+		if (slab->freeEntryCount++ == 0)
+			LinkPartialSlab(slab);
+
+		sizeClass.allocatedEntryCount--;
+	}
+
+	/*!
+	* \brief Gets the number of allocations currently alive
+	* \return Number of allocated entries of all size classes (allocations bigger than MaxSizeClass are not counted)
+	*/
+	inline std::size_t SlabAllocator::GetAllocatedEntryCount() const
+	{
+		std::size_t allocatedEntryCount = 0;
+		for (const SizeClass& sizeClass : m_sizeClasses)
+			allocatedEntryCount += sizeClass.allocatedEntryCount;
+
+		return allocatedEntryCount;
+	}
+
+	/*!
+	* \brief Gets the number of slabs currently allocated
+	* \return Slab count of all size classes
+	*/
+	inline std::size_t SlabAllocator::GetSlabCount() const
+	{
+		std::size_t slabCount = 0;
+		for (const SizeClass& sizeClass : m_sizeClasses)
+			slabCount += sizeClass.slabs.size();
+
+		return slabCount;
+	}
+
+	/*!
+	* \brief Gets the slab size
+	* \return Size of a slab in bytes
+	*/
+	inline std::size_t SlabAllocator::GetSlabSize() const
+	{
+		return m_slabSize;
+	}
+
+	/*!
+	* \brief Releases slabs which have no allocated entry
+	* \return Number of released slabs
+	*/
+	inline std::size_t SlabAllocator::ReleaseEmptySlabs()
+	{
+		std::size_t releasedSlabCount = 0;
+		for (SizeClass& sizeClass : m_sizeClasses)
+		{
+			auto it = std::remove_if(sizeClass.slabs.begin(), sizeClass.slabs.end(), [&](Slab* slab)
+			{
+				if (slab->freeEntryCount != sizeClass.entryCountPerSlab)
+					return false;
+
+				UnlinkPartialSlab(slab);
+				FreeSlab(slab);
+				return true;
+			});
+
+			releasedSlabCount += std::distance(it, sizeClass.slabs.end());
+			sizeClass.slabs.erase(it, sizeClass.slabs.end());
+		}
+
+		return releasedSlabCount;
+	}
+
+	inline SlabAllocator& SlabAllocator::operator=(SlabAllocator&& allocator) noexcept
+	{
+		Clear();
+
+		m_sizeClasses = std::move(allocator.m_sizeClasses);
+		m_slabSize = allocator.m_slabSize;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Retrieves the size class of an allocation size
+	* \return Index of the size class
+	*
+	* \param size Allocation size, must be less or equal to MaxSizeClass
+	*/
+	constexpr std::size_t SlabAllocator::GetSizeClassIndex(std::size_t size)
+	{
+		assert(size <= MaxSizeClass);
+
+		if (size <= 8)
+			return 0;
+
+		if (size <= 64)
+			return (size + 15) / 16;
+
+		// Four size classes per power of two: ]2^k, 2^k+1]
+		std::size_t k = IntegralLog2(size - 1);
+		std::size_t step = std::size_t(1) << (k - 2);
+		std::size_t subIndex = (size - (std::size_t(1) << k) + step - 1) / step;
+
+		return 5 + (k - 6) * 4 + (subIndex - 1);
+	}
+
+	/*!
+	* \brief Retrieves the allocation size of a size class
+	* \return Size of entries of the size class in bytes
+	*
+	* \param sizeClassIndex Index of the size class
+	*/
+	constexpr std::size_t SlabAllocator::GetSizeClassSize(std::size_t sizeClassIndex)
+	{
+		assert(sizeClassIndex < SizeClassCount);
+
+		if (sizeClassIndex == 0)
+			return 8;
+
+		if (sizeClassIndex <= 4)
+			return sizeClassIndex * 16;
+
+		std::size_t k = 6 + (sizeClassIndex - 5) / 4;
+		std::size_t subIndex = (sizeClassIndex - 5) % 4 + 1;
+
+		return (std::size_t(1) << k) + subIndex * (std::size_t(1) << (k - 2));
+	}
+
+	inline auto SlabAllocator::AllocateSlab(std::size_t sizeClassIndex) -> Slab*
+	{
+		SizeClass& sizeClass = m_sizeClasses[sizeClassIndex];
+
+		// Slabs are aligned to their size so that the slab header can be retrieved from any entry address
+		void* memory = ::operator new(m_slabSize, std::align_val_t(m_slabSize));
+
+		Slab* slab = PlacementNew(static_cast<Slab*>(memory));
+		slab->freeEntries = Bitset<UInt64>(sizeClass.entryCountPerSlab, true);
+		slab->entries = static_cast<std::byte*>(memory) + GetSlabHeaderSize();
+		slab->firstFreeBlockHint = 0;
+		slab->freeEntryCount = sizeClass.entryCountPerSlab;
+		slab->sizeClassIndex = sizeClassIndex;
+		slab->previousPartial = nullptr;
+		slab->nextPartial = nullptr;
+
+		sizeClass.slabs.push_back(slab);
+		LinkPartialSlab(slab);
+
+		return slab;
+	}
+
+	inline void SlabAllocator::FreeSlab(Slab* slab)
+	{
+		PlacementDestroy(slab);
+		::operator delete(static_cast<void*>(slab), std::align_val_t(m_slabSize));
+	}
+
+	inline auto SlabAllocator::GetSlab(const void* ptr) const -> Slab*
+	{
+		return IntegerToPointer<Slab*>(PointerToInteger<std::uintptr_t>(ptr) & ~std::uintptr_t(m_slabSize - 1));
+	}
+
+	inline void SlabAllocator::LinkPartialSlab(Slab* slab)
+	{
+		SizeClass& sizeClass = m_sizeClasses[slab->sizeClassIndex];
+
+		slab->previousPartial = nullptr;
+		slab->nextPartial = sizeClass.partialSlabs;
+		if (sizeClass.partialSlabs)
+			sizeClass.partialSlabs->previousPartial = slab;
+
+		sizeClass.partialSlabs = slab;
+	}
+
+	inline void SlabAllocator::UnlinkPartialSlab(Slab* slab)
+	{
+		SizeClass& sizeClass = m_sizeClasses[slab->sizeClassIndex];
+
+		if (slab->previousPartial)
+			slab->previousPartial->nextPartial = slab->nextPartial;
+		else
+		{
+			assert(sizeClass.partialSlabs == slab);
+			sizeClass.partialSlabs = slab->nextPartial;
+		}
+
+		if (slab->nextPartial)
+			slab->nextPartial->previousPartial = slab->previousPartial;
+
+		slab->previousPartial = nullptr;
+		slab->nextPartial = nullptr;
+	}
+
+	constexpr std::size_t SlabAllocator::GetSlabHeaderSize()
+	{
+		return AlignPow2(sizeof(Slab), alignof(std::max_align_t));
+	}
+}
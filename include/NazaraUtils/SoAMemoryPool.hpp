@@ -0,0 +1,102 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_SOAMEMORYPOOL_HPP
+#define NAZARAUTILS_SOAMEMORYPOOL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <NazaraUtils/TypeList.hpp>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	template<typename FieldList>
+	class SoAMemoryPool;
+
+	template<typename... Fields>
+	class SoAMemoryPool<TypeList<Fields...>>
+	{
+		static_assert(sizeof...(Fields) > 0, "SoAMemoryPool requires at least one field");
+
+		public:
+			using FieldList = TypeList<Fields...>;
+
+			class DeferConstruct_t {};
+			class NoDestruction_t {};
+
+			SoAMemoryPool(std::size_t blockSize);
+			SoAMemoryPool(const SoAMemoryPool&) = delete;
+			SoAMemoryPool(SoAMemoryPool&&) noexcept = default;
+			~SoAMemoryPool();
+
+			std::tuple<Fields*...> Allocate(DeferConstruct_t, std::size_t& index);
+			template<typename... Args> std::tuple<Fields*...> Allocate(std::size_t& index, Args&&... args);
+
+			void Clear();
+
+			template<typename F> void ForEach(F&& func);
+			template<typename F> void ForEach(F&& func) const;
+			template<typename... SelectedFields, typename F> void ForEachSpan(F&& func);
+			template<typename... SelectedFields, typename F> void ForEachSpan(F&& func) const;
+
+			void Free(std::size_t index);
+			void Free(std::size_t index, NoDestruction_t);
+
+			template<typename Field> Field& Get(std::size_t index);
+			template<typename Field> const Field& Get(std::size_t index) const;
+			template<std::size_t FieldIndex> TypeListAt<FieldList, FieldIndex>& Get(std::size_t index);
+			template<std::size_t FieldIndex> const TypeListAt<FieldList, FieldIndex>& Get(std::size_t index) const;
+
+			std::size_t GetAllocatedEntryCount() const;
+			std::size_t GetBlockCount() const;
+			std::size_t GetBlockSize() const;
+			std::size_t GetFreeEntryCount() const;
+
+			bool IsAllocated(std::size_t index) const;
+
+			void Reset();
+
+			SoAMemoryPool& operator=(const SoAMemoryPool&) = delete;
+			SoAMemoryPool& operator=(SoAMemoryPool&& pool) noexcept = default;
+
+			static constexpr DeferConstruct_t DeferConstruct = {};
+			static constexpr std::size_t FieldCount = sizeof...(Fields);
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+			static constexpr NoDestruction_t NoDestruction = {};
+
+		private:
+			template<typename Field> using AlignedStorage = std::aligned_storage_t<sizeof(Field), alignof(Field)>;
+
+			struct Block
+			{
+				std::size_t occupiedEntryCount = 0;
+				std::tuple<std::unique_ptr<AlignedStorage<Fields>[]>...> memory;
+				Bitset<UInt64> freeEntries;
+				Bitset<UInt64> occupiedEntries; //< Opposite of freeEntries
+			};
+
+			void AllocateBlock();
+			template<typename... Args, std::size_t... I> void ConstructFields(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>, Args&&... args);
+			template<std::size_t... I> void DestroyFields(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>);
+			template<bool Const, typename F, std::size_t... I> void ForEachInBlock(std::size_t blockIndex, F& func, std::index_sequence<I...>) const;
+			template<bool Const, typename... SelectedFields, typename F> void ForEachSpanInBlock(std::size_t blockIndex, F& func) const;
+			template<std::size_t FieldIndex> TypeListAt<FieldList, FieldIndex>* GetFieldPointer(std::size_t blockIndex, std::size_t localIndex) const;
+			template<std::size_t... I> std::tuple<Fields*...> GetFieldPointers(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>) const;
+			template<typename Field> static constexpr std::size_t GetFieldIndex();
+
+			std::size_t m_blockSize;
+			std::vector<Block> m_blocks;
+	};
+}
+
+#include <NazaraUtils/SoAMemoryPool.inl>
+
+#endif // NAZARAUTILS_SOAMEMORYPOOL_HPP
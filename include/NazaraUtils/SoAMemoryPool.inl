@@ -0,0 +1,478 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <cassert>
+#include <new>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::SoAMemoryPool
+	* \brief Memory pool storing each field of its entries in a separate array (structure of arrays)
+	*
+	* Entries are allocated the same way as with MemoryPool, and share a single index space, but each field has its own contiguous array in every block.
+	* This allows iterating on a few fields without bringing the others into cache, and to process contiguous fields with SIMD.
+	*
+	* \see MemoryPool
+	*/
+
+	/*!
+	* \brief Constructs a SoAMemoryPool object
+	*
+	* \param blockSize Size of blocks that will be allocated
+	*/
+	template<typename... Fields>
+	SoAMemoryPool<TypeList<Fields...>>::SoAMemoryPool(std::size_t blockSize) :
+	m_blockSize(blockSize)
+	{
+		// Allocate one block by default
+		AllocateBlock();
+	}
+
+	/*!
+	* \brief Destroy the memory pool, calling the destructor of every field of every allocated entry and desallocating blocks
+	*/
+	template<typename... Fields>
+	SoAMemoryPool<TypeList<Fields...>>::~SoAMemoryPool()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Allocates memory for an entry without constructing its fields
+	* \return Pointers to every field of the allocated entry
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	*/
+	template<typename... Fields>
+	std::tuple<Fields*...> SoAMemoryPool<TypeList<Fields...>>::Allocate(DeferConstruct_t, std::size_t& index)
+	{
+		std::size_t blockIndex = 0;
+		std::size_t localIndex = InvalidIndex;
+		for (; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			auto& block = m_blocks[blockIndex];
+			if (block.occupiedEntryCount == m_blockSize)
+				continue;
+
+			localIndex = block.freeEntries.FindFirst();
+			assert(localIndex != block.freeEntries.npos);
+			break;
+		}
+
+		if (blockIndex >= m_blocks.size())
+		{
+			// No more room, allocate a new block
+			blockIndex = m_blocks.size();
+			localIndex = 0;
+
+			AllocateBlock();
+		}
+
+		assert(localIndex != InvalidIndex);
+
+		auto& block = m_blocks[blockIndex];
+		block.freeEntries.Reset(localIndex);
+		block.occupiedEntries.Set(localIndex);
+		block.occupiedEntryCount++;
+
+		index = blockIndex * m_blockSize + localIndex;
+
+		return GetFieldPointers(blockIndex, localIndex, std::index_sequence_for<Fields...>());
+	}
+
+	/*!
+	* \brief Allocates an entry and constructs its fields
+	* \return Pointers to every field of the allocated entry
+	*
+	* \param index Output entry index (which can be used for deallocation)
+	* \param args Either nothing (every field is value-initialized) or one argument per field, used to construct it
+	*/
+	template<typename... Fields>
+	template<typename... Args>
+	std::tuple<Fields*...> SoAMemoryPool<TypeList<Fields...>>::Allocate(std::size_t& index, Args&&... args)
+	{
+		static_assert(sizeof...(Args) == 0 || sizeof...(Args) == FieldCount, "expected either no argument or one argument per field");
+
+		auto fields = Allocate(DeferConstruct, index);
+		ConstructFields(index / m_blockSize, index % m_blockSize, std::index_sequence_for<Fields...>(), std::forward<Args>(args)...);
+
+		return fields;
+	}
+
+	/*!
+	* \brief Clears the memory pool
+	*
+	* This is call the destructor of every active entry and invalidate every entry index, and will free every allocated block
+	*
+	* \see Reset
+	*/
+	template<typename... Fields>
+	void SoAMemoryPool<TypeList<Fields...>>::Clear()
+	{
+		Reset();
+
+		m_blocks.clear();
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool
+	*
+	* \param func Function called with a reference to every field of each entry (Fields&...), or with its index followed by them (std::size_t, Fields&...)
+	*
+	* \remark Freeing the visited entry from func is allowed, allocating from the pool is not
+	*/
+	template<typename... Fields>
+	template<typename F>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEach(F&& func)
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+			ForEachInBlock<false>(blockIndex, func, std::index_sequence_for<Fields...>());
+	}
+
+	/*!
+	* \brief Calls a function on every allocated entry of the pool
+	*
+	* \param func Function called with a const reference to every field of each entry (const Fields&...), or with its index followed by them (std::size_t, const Fields&...)
+	*/
+	template<typename... Fields>
+	template<typename F>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEach(F&& func) const
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+			ForEachInBlock<true>(blockIndex, func, std::index_sequence_for<Fields...>());
+	}
+
+	/*!
+	* \brief Calls a function on every contiguous range of allocated entries
+	*
+	* func is called as func(firstIndex, count, SelectedFields*...) with pointers to arrays of count contiguous fields, allowing SIMD processing.
+	* Ranges never cross block boundaries.
+	*
+	* \tparam SelectedFields Fields to retrieve, every field is retrieved (in declaration order) if none is specified
+	*
+	* \param func Function called for each range
+	*/
+	template<typename... Fields>
+	template<typename... SelectedFields, typename F>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEachSpan(F&& func)
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			if constexpr (sizeof...(SelectedFields) == 0)
+				ForEachSpanInBlock<false, Fields...>(blockIndex, func);
+			else
+				ForEachSpanInBlock<false, SelectedFields...>(blockIndex, func);
+		}
+	}
+
+	/*!
+	* \brief Calls a function on every contiguous range of allocated entries
+	*
+	* func is called as func(firstIndex, count, const SelectedFields*...).
+	*
+	* \tparam SelectedFields Fields to retrieve, every field is retrieved (in declaration order) if none is specified
+	*
+	* \param func Function called for each range
+	*/
+	template<typename... Fields>
+	template<typename... SelectedFields, typename F>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEachSpan(F&& func) const
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			if constexpr (sizeof...(SelectedFields) == 0)
+				ForEachSpanInBlock<true, Fields...>(blockIndex, func);
+			else
+				ForEachSpanInBlock<true, SelectedFields...>(blockIndex, func);
+		}
+	}
+
+	/*!
+	* \brief Returns an entry memory to the memory pool
+	*
+	* Calls the destructor of every field of the target entry and returns its memory to the pool
+	*
+	* \param index Index of the allocated entry
+	*/
+	template<typename... Fields>
+	void SoAMemoryPool<TypeList<Fields...>>::Free(std::size_t index)
+	{
+		std::size_t blockIndex = index / m_blockSize;
+		std::size_t localIndex = index % m_blockSize;
+
+		DestroyFields(blockIndex, localIndex, std::index_sequence_for<Fields...>());
+		Free(index, NoDestruction);
+	}
+
+	/*!
+	* \brief Returns an entry memory to the memory pool, without calling any destructor
+	*
+	* \param index Index of the allocated entry
+	*/
+	template<typename... Fields>
+	void SoAMemoryPool<TypeList<Fields...>>::Free(std::size_t index, NoDestruction_t)
+	{
+		std::size_t blockIndex = index / m_blockSize;
+		std::size_t localIndex = index % m_blockSize;
+
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+		assert(block.occupiedEntries.Test(localIndex));
+		assert(block.occupiedEntryCount > 0);
+		block.occupiedEntryCount--;
+
+		block.freeEntries.Set(localIndex);
+		block.occupiedEntries.Reset(localIndex);
+	}
+
+	/*!
+	* \brief Retrieves a field of an allocated entry
+	* \return Reference to the field
+	*
+	* \tparam Field Type of the field (must be unique in the field list)
+	* \param index Entry index
+	*
+	* \remark index must be valid
+	*/
+	template<typename... Fields>
+	template<typename Field>
+	Field& SoAMemoryPool<TypeList<Fields...>>::Get(std::size_t index)
+	{
+		return Get<GetFieldIndex<Field>()>(index);
+	}
+
+	template<typename... Fields>
+	template<typename Field>
+	const Field& SoAMemoryPool<TypeList<Fields...>>::Get(std::size_t index) const
+	{
+		return Get<GetFieldIndex<Field>()>(index);
+	}
+
+	/*!
+	* \brief Retrieves a field of an allocated entry
+	* \return Reference to the field
+	*
+	* \tparam FieldIndex Index of the field in the field list
+	* \param index Entry index
+	*
+	* \remark index must be valid
+	*/
+	template<typename... Fields>
+	template<std::size_t FieldIndex>
+	auto SoAMemoryPool<TypeList<Fields...>>::Get(std::size_t index) -> TypeListAt<FieldList, FieldIndex>&
+	{
+		assert(IsAllocated(index));
+		return *GetFieldPointer<FieldIndex>(index / m_blockSize, index % m_blockSize);
+	}
+
+	template<typename... Fields>
+	template<std::size_t FieldIndex>
+	auto SoAMemoryPool<TypeList<Fields...>>::Get(std::size_t index) const -> const TypeListAt<FieldList, FieldIndex>&
+	{
+		assert(IsAllocated(index));
+		return *GetFieldPointer<FieldIndex>(index / m_blockSize, index % m_blockSize);
+	}
+
+	/*!
+	* \brief Returns the number of allocated entries
+	* \return How many entries are currently allocated
+	*/
+	template<typename... Fields>
+	std::size_t SoAMemoryPool<TypeList<Fields...>>::GetAllocatedEntryCount() const
+	{
+		std::size_t count = 0;
+		for (auto& block : m_blocks)
+			count += block.occupiedEntryCount;
+
+		return count;
+	}
+
+	/*!
+	* \brief Gets the block count
+	* \return How many block are currently allocated for this memory pool
+	*/
+	template<typename... Fields>
+	std::size_t SoAMemoryPool<TypeList<Fields...>>::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the block size
+	* \return Size of each block (i.e. how many entries can fit in a block)
+	*/
+	template<typename... Fields>
+	std::size_t SoAMemoryPool<TypeList<Fields...>>::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Returns the number of free entries
+	* \return How many entries are currently freed
+	*/
+	template<typename... Fields>
+	std::size_t SoAMemoryPool<TypeList<Fields...>>::GetFreeEntryCount() const
+	{
+		std::size_t count = m_blocks.size() * m_blockSize;
+		return count - GetAllocatedEntryCount();
+	}
+
+	/*!
+	* \brief Checks if an index refers to an allocated entry
+	* \return True if the entry is allocated
+	*
+	* \param index Entry index
+	*/
+	template<typename... Fields>
+	bool SoAMemoryPool<TypeList<Fields...>>::IsAllocated(std::size_t index) const
+	{
+		std::size_t blockIndex = index / m_blockSize;
+		if (blockIndex >= m_blocks.size())
+			return false;
+
+		return m_blocks[blockIndex].occupiedEntries.Test(index % m_blockSize);
+	}
+
+	/*!
+	* \brief Resets the memory pool
+	*
+	* This is call the destructor of every active entry and invalidate every entry index, returning the pool to full capacity
+	* Note that memory is not freed
+	*
+	* \see Clear
+	*/
+	template<typename... Fields>
+	void SoAMemoryPool<TypeList<Fields...>>::Reset()
+	{
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size(); ++blockIndex)
+		{
+			auto& block = m_blocks[blockIndex];
+			if (block.occupiedEntryCount == 0)
+				continue;
+
+			if constexpr (!(std::is_trivially_destructible_v<Fields> && ...))
+			{
+				for (std::size_t localIndex = block.occupiedEntries.FindFirst(); localIndex != block.occupiedEntries.npos; localIndex = block.occupiedEntries.FindNext(localIndex))
+					DestroyFields(blockIndex, localIndex, std::index_sequence_for<Fields...>());
+			}
+
+			block.freeEntries.Reset(true);
+			block.occupiedEntries.Reset(false);
+			block.occupiedEntryCount = 0;
+		}
+	}
+
+	template<typename... Fields>
+	void SoAMemoryPool<TypeList<Fields...>>::AllocateBlock()
+	{
+		auto& block = m_blocks.emplace_back();
+		block.freeEntries.Resize(m_blockSize, true);
+		block.occupiedEntries.Resize(m_blockSize, false);
+		block.memory = std::make_tuple(std::make_unique<AlignedStorage<Fields>[]>(m_blockSize)...);
+	}
+
+	template<typename... Fields>
+	template<typename... Args, std::size_t... I>
+	void SoAMemoryPool<TypeList<Fields...>>::ConstructFields(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>, Args&&... args)
+	{
+		if constexpr (sizeof...(Args) == 0)
+			(PlacementNew(GetFieldPointer<I>(blockIndex, localIndex)), ...);
+		else
+			(PlacementNew(GetFieldPointer<I>(blockIndex, localIndex), std::forward<Args>(args)), ...);
+	}
+
+	template<typename... Fields>
+	template<std::size_t... I>
+	void SoAMemoryPool<TypeList<Fields...>>::DestroyFields(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>)
+	{
+		(PlacementDestroy(GetFieldPointer<I>(blockIndex, localIndex)), ...);
+	}
+
+	template<typename... Fields>
+	template<bool Const, typename F, std::size_t... I>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEachInBlock(std::size_t blockIndex, F& func, std::index_sequence<I...>) const
+	{
+		constexpr std::size_t bitsPerWord = Bitset<UInt64>::bitsPerBlock;
+
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+
+		std::size_t remainingEntries = block.occupiedEntryCount;
+		std::size_t wordCount = block.occupiedEntries.GetBlockCount();
+		for (std::size_t wordIndex = 0; wordIndex < wordCount && remainingEntries > 0; ++wordIndex)
+		{
+			UInt64 word = block.occupiedEntries.GetBlock(wordIndex);
+			std::size_t baseIndex = wordIndex * bitsPerWord;
+
+			while (word != 0)
+			{
+				std::size_t localIndex = baseIndex + FindFirstBit(word) - 1;
+				word &= word - 1; //< clear lowest set bit
+
+				if constexpr (std::is_invocable_v<F&, std::conditional_t<Const, const Fields&, Fields&>...>)
+					func(*static_cast<std::conditional_t<Const, const Fields*, Fields*>>(GetFieldPointer<I>(blockIndex, localIndex))...);
+				else
+					func(blockIndex * m_blockSize + localIndex, *static_cast<std::conditional_t<Const, const Fields*, Fields*>>(GetFieldPointer<I>(blockIndex, localIndex))...);
+
+				remainingEntries--;
+			}
+		}
+	}
+
+	template<typename... Fields>
+	template<bool Const, typename... SelectedFields, typename F>
+	void SoAMemoryPool<TypeList<Fields...>>::ForEachSpanInBlock(std::size_t blockIndex, F& func) const
+	{
+		assert(blockIndex < m_blocks.size());
+		auto& block = m_blocks[blockIndex];
+		if (block.occupiedEntryCount == 0)
+			return;
+
+		std::size_t firstIndex = block.occupiedEntries.FindFirst();
+		while (firstIndex != block.occupiedEntries.npos)
+		{
+			// freeEntries being the opposite of occupiedEntries, the next free entry marks the end of the range
+			std::size_t lastIndex = block.freeEntries.FindNext(firstIndex);
+			if (lastIndex == block.freeEntries.npos)
+				lastIndex = m_blockSize;
+
+			func(blockIndex * m_blockSize + firstIndex, lastIndex - firstIndex, static_cast<std::conditional_t<Const, const SelectedFields*, SelectedFields*>>(GetFieldPointer<GetFieldIndex<SelectedFields>()>(blockIndex, firstIndex))...);
+
+			if (lastIndex >= m_blockSize)
+				break;
+
+			firstIndex = block.occupiedEntries.FindNext(lastIndex);
+		}
+	}
+
+	template<typename... Fields>
+	template<std::size_t FieldIndex>
+	auto SoAMemoryPool<TypeList<Fields...>>::GetFieldPointer(std::size_t blockIndex, std::size_t localIndex) const -> TypeListAt<FieldList, FieldIndex>*
+	{
+		using Field = TypeListAt<FieldList, FieldIndex>;
+
+		assert(blockIndex < m_blocks.size());
+		assert(localIndex < m_blockSize);
+		return std::launder(reinterpret_cast<Field*>(&std::get<FieldIndex>(m_blocks[blockIndex].memory)[localIndex]));
+	}
+
+	template<typename... Fields>
+	template<std::size_t... I>
+	std::tuple<Fields*...> SoAMemoryPool<TypeList<Fields...>>::GetFieldPointers(std::size_t blockIndex, std::size_t localIndex, std::index_sequence<I...>) const
+	{
+		return { GetFieldPointer<I>(blockIndex, localIndex)... };
+	}
+
+	template<typename... Fields>
+	template<typename Field>
+	constexpr std::size_t SoAMemoryPool<TypeList<Fields...>>::GetFieldIndex()
+	{
+		static_assert(((std::is_same_v<Field, Fields> ? 1 : 0) + ...) == 1, "field type must appear exactly once in the field list, use the field index instead");
+		return TypeListFind<FieldList, Field>;
+	}
+}
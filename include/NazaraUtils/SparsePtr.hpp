@@ -11,6 +11,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 
 namespace Nz
@@ -22,6 +23,13 @@ namespace Nz
 			using BytePtr = std::conditional_t<std::is_const<T>::value, const UInt8*, UInt8*>;
 			using VoidPtr = std::conditional_t<std::is_const<T>::value, const void*, void*>;
 
+			// Iterator interface
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+			using pointer = T*;
+			using reference = T&;
+			using value_type = std::remove_cv_t<T>;
+
 			SparsePtr();
 			SparsePtr(T* ptr);
 			SparsePtr(VoidPtr ptr, int stride);
@@ -123,6 +123,15 @@ namespace Nz
 		assert(pos >= begin() && pos <= end());
 
 		std::size_t index = std::distance(cbegin(), pos);
+		if constexpr (IsTriviallyRelocatable_v<T> && std::is_nothrow_constructible_v<T, Args&&...>)
+		{
+			// Shift elements with a single memmove, constructing the new element can't fail
+			Relocate(&m_ptr[index + 1], &m_ptr[index], m_size - index);
+			m_size++;
+
+			return PlacementNew(&m_ptr[index], std::forward<Args>(args)...);
+		}
+
 		if (pos < end())
 		{
 			iterator lastElement = end() - 1;
@@ -169,8 +178,17 @@ namespace Nz
 	{
 		assert(pos < end());
 		std::size_t index = std::distance(cbegin(), pos);
-		std::move(begin() + index + 1, end(), begin() + index);
-		pop_back();
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			PlacementDestroy(&m_ptr[index]);
+			Relocate(&m_ptr[index], &m_ptr[index + 1], m_size - index - 1);
+			m_size--;
+		}
+		else
+		{
+			std::move(begin() + index + 1, end(), begin() + index);
+			pop_back();
+		}
 
 		return iterator(&m_ptr[index]);
 	}
@@ -188,8 +206,19 @@ namespace Nz
 
 		std::size_t count = std::distance(first, last);
 
-		std::move(begin() + index + count, end(), begin() + index);
-		resize(size() - count);
+		if constexpr (IsTriviallyRelocatable_v<T>)
+		{
+			for (std::size_t i = index; i < index + count; ++i)
+				PlacementDestroy(&m_ptr[i]);
+
+			Relocate(&m_ptr[index], &m_ptr[index + count], m_size - index - count);
+			m_size -= count;
+		}
+		else
+		{
+			std::move(begin() + index + count, end(), begin() + index);
+			resize(size() - count);
+		}
 
 		return iterator(&m_ptr[index]);
 	}
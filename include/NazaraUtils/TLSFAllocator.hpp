@@ -0,0 +1,111 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TLSFALLOCATOR_HPP
+#define NAZARAUTILS_TLSFALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <utility>
+
+namespace Nz
+{
+	class TLSFAllocator
+	{
+		struct BlockHeader;
+
+		public:
+			static constexpr std::size_t Alignment = alignof(std::max_align_t);
+			static constexpr unsigned int MaxBlockSizeLog2 = std::min<unsigned int>(32, sizeof(std::size_t) * CHAR_BIT - 1); //< 31 on 32-bit platforms, to keep sizes representable
+			static constexpr std::size_t MaxAllocationSize = (std::size_t(1) << MaxBlockSizeLog2) - Alignment;
+
+			TLSFAllocator(void* memory, std::size_t size);
+			TLSFAllocator(const TLSFAllocator&) = delete;
+			TLSFAllocator(TLSFAllocator&&) = delete;
+			~TLSFAllocator() = default;
+
+			void* Allocate(std::size_t size, std::size_t alignment = Alignment);
+
+			bool CheckIntegrity() const;
+
+			void Free(void* ptr);
+
+			std::size_t GetAllocatedSize() const;
+
+			void* Reallocate(void* ptr, std::size_t size, std::size_t alignment = Alignment);
+
+			TLSFAllocator& operator=(const TLSFAllocator&) = delete;
+			TLSFAllocator& operator=(TLSFAllocator&&) = delete;
+
+			static std::size_t GetAllocationSize(const void* ptr);
+
+		private:
+			BlockHeader* FindFreeBlock(std::size_t size);
+			void InsertFreeBlock(BlockHeader* block);
+			void MarkAsUsed(BlockHeader* block);
+			BlockHeader* MergeWithNextFreeBlock(BlockHeader* block);
+			void RemoveFreeBlock(BlockHeader* block);
+			void RemoveFreeBlock(BlockHeader* block, unsigned int firstLevelIndex, unsigned int secondLevelIndex);
+			void TrimBlock(BlockHeader* block, std::size_t size);
+
+			static void AbsorbNextBlock(BlockHeader* block, BlockHeader* nextBlock);
+			static std::size_t AdjustSize(std::size_t size);
+			static BlockHeader* GetBlockFromPayload(const void* ptr);
+			static std::size_t GetBlockSize(const BlockHeader* block);
+			static BlockHeader* GetNextPhysicalBlock(const BlockHeader* block);
+			static std::byte* GetPayload(const BlockHeader* block);
+			static bool IsFree(const BlockHeader* block);
+			static bool IsPreviousFree(const BlockHeader* block);
+			static std::pair<unsigned int, unsigned int> MapInsert(std::size_t size);
+			static std::pair<unsigned int, unsigned int> MapSearch(std::size_t size);
+			static void SetBlockSize(BlockHeader* block, std::size_t size);
+			static void SetFree(BlockHeader* block, bool free);
+			static void SetPreviousFree(BlockHeader* block, bool free);
+			static BlockHeader* SplitBlock(BlockHeader* block, std::size_t size);
+
+			struct BlockHeader
+			{
+				std::size_t sizeAndFlags; //< payload size, low bits are used for flags (sizes are multiple of Alignment)
+				BlockHeader* previousPhysical;
+			};
+
+			// Stored in the payload of free blocks
+			struct FreeLinks
+			{
+				BlockHeader* next;
+				BlockHeader* previous;
+			};
+
+			static constexpr std::size_t FreeFlag = 1 << 0;
+			static constexpr std::size_t PreviousFreeFlag = 1 << 1;
+			static constexpr std::size_t FlagMask = FreeFlag | PreviousFreeFlag;
+
+			static constexpr unsigned int SecondLevelIndexCountLog2 = 5;
+			static constexpr unsigned int SecondLevelIndexCount = 1u << SecondLevelIndexCountLog2;
+			static constexpr unsigned int FirstLevelShift = SecondLevelIndexCountLog2 + IntegralLog2Pot(Alignment);
+			static constexpr unsigned int FirstLevelIndexCount = MaxBlockSizeLog2 - FirstLevelShift + 1;
+			static constexpr std::size_t HeaderSize = AlignPow2(sizeof(BlockHeader), Alignment);
+			static constexpr std::size_t MinBlockSize = AlignPow2(sizeof(FreeLinks), Alignment);
+			static constexpr std::size_t SmallBlockSize = std::size_t(1) << FirstLevelShift;
+
+			static_assert(FirstLevelIndexCount <= 32);
+			static_assert(Alignment > FlagMask);
+
+			std::array<std::array<BlockHeader*, SecondLevelIndexCount>, FirstLevelIndexCount> m_freeLists;
+			std::array<UInt32, FirstLevelIndexCount> m_secondLevelBitmaps;
+			BlockHeader* m_firstBlock;
+			UInt32 m_firstLevelBitmap;
+			std::size_t m_allocatedSize;
+	};
+}
+
+#include <NazaraUtils/TLSFAllocator.inl>
+
+#endif // NAZARAUTILS_TLSFALLOCATOR_HPP
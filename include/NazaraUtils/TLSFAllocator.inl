@@ -0,0 +1,505 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/Assert.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utils
+	* \class Nz::TLSFAllocator
+	* \brief Two-Level Segregated Fit allocator, offering O(1) allocation and deallocation of variable-size blocks in a caller-provided memory region
+	*
+	* Free blocks are sorted in segregated lists, indexed first by the power of two of their size and then by a linear subdivision of it.
+	* Two levels of bitmaps track which lists are non-empty, finding a suitable block is then only a matter of a few FindFirstBit/FindLastBit.
+	* Adjacent free blocks are merged immediately on deallocation, which bounds fragmentation.
+	*
+	* Every block is preceded by a small header (two pointers), allocations are aligned to Alignment unless a bigger alignment is requested.
+	*
+	* \remark This allocator doesn't own the memory region, which must outlive it
+	* \remark This allocator is not thread-safe
+	* \remark Allocation failures are reported by returning nullptr, to be usable in contexts where exceptions are not
+	*/
+
+	/*!
+	* \brief Constructs a TLSFAllocator object managing a memory region
+	*
+	* \param memory Pointer to the memory region
+	* \param size Size of the memory region in bytes, only MaxAllocationSize bytes can be used if it's bigger
+	*/
+	inline TLSFAllocator::TLSFAllocator(void* memory, std::size_t size) :
+	m_firstLevelBitmap(0),
+	m_allocatedSize(0)
+	{
+		for (auto& freeLists : m_freeLists)
+			freeLists.fill(nullptr);
+
+		m_secondLevelBitmaps.fill(0);
+
+		std::uintptr_t regionStart = PointerToInteger<std::uintptr_t>(memory);
+		std::uintptr_t alignedStart = AlignPow2<std::uintptr_t>(regionStart, Alignment);
+		NazaraAssertMsg(size >= alignedStart - regionStart + 2 * HeaderSize + MinBlockSize, "memory region is too small");
+
+		std::size_t usableSize = size - (alignedStart - regionStart);
+
+		// The region is one big free block followed by an empty used block, which prevents merging past the region end
+		std::size_t blockSize = std::min((usableSize - 2 * HeaderSize) & ~(Alignment - 1), MaxAllocationSize);
+
+		m_firstBlock = IntegerToPointer<BlockHeader*>(alignedStart);
+		m_firstBlock->sizeAndFlags = blockSize | FreeFlag;
+		m_firstBlock->previousPhysical = nullptr;
+
+		BlockHeader* sentinel = GetNextPhysicalBlock(m_firstBlock);
+		sentinel->sizeAndFlags = PreviousFreeFlag;
+		sentinel->previousPhysical = m_firstBlock;
+
+		InsertFreeBlock(m_firstBlock);
+	}
+
+	/*!
+	* \brief Allocates a block of memory
+	* \return Pointer to the allocated memory, or nullptr if no free block is big enough (or if size is zero)
+	*
+	* \param size Size of the allocation in bytes
+	* \param alignment Power of two alignment of the allocation
+	*/
+	inline void* TLSFAllocator::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NazaraAssertMsg(IsPow2(alignment), "alignment must be a power of two");
+
+		if (size == 0 || size > MaxAllocationSize)
+			return nullptr;
+
+		std::size_t adjustedSize = AdjustSize(size);
+
+		// A gap before the aligned payload has to be big enough to become a free block
+		constexpr std::size_t MinGapSize = HeaderSize + MinBlockSize;
+
+		std::size_t searchSize = adjustedSize;
+		if (alignment > Alignment)
+		{
+			searchSize += alignment + MinGapSize;
+			if (searchSize > MaxAllocationSize)
+				return nullptr;
+		}
+
+		BlockHeader* block = FindFreeBlock(searchSize);
+		if (!block)
+			return nullptr;
+
+		if (alignment > Alignment)
+		{
+			std::uintptr_t payloadAddress = PointerToInteger<std::uintptr_t>(GetPayload(block));
+			std::size_t gap = AlignPow2<std::uintptr_t>(payloadAddress, alignment) - payloadAddress;
+			if (gap > 0 && gap < MinGapSize)
+				gap = AlignPow2<std::uintptr_t>(payloadAddress + MinGapSize, alignment) - payloadAddress;
+
+			if (gap > 0)
+			{
+				BlockHeader* alignedBlock = SplitBlock(block, gap - HeaderSize);
+				InsertFreeBlock(block);
+
+				block = alignedBlock;
+			}
+		}
+
+		TrimBlock(block, adjustedSize);
+		MarkAsUsed(block);
+
+		m_allocatedSize += GetBlockSize(block);
+
+		return GetPayload(block);
+	}
+
+	/*!
+	* \brief Walks over every block to check the allocator internal structures
+	* \return True if everything is consistent
+	*
+	* \remark This is O(n) and is meant for debugging and testing purposes
+	*/
+	inline bool TLSFAllocator::CheckIntegrity() const
+	{
+		bool previousFree = false;
+		const BlockHeader* previousBlock = nullptr;
+		for (const BlockHeader* block = m_firstBlock;; block = GetNextPhysicalBlock(block))
+		{
+			if (block->previousPhysical != previousBlock && previousFree)
+				return false;
+
+			if (IsPreviousFree(block) != previousFree)
+				return false;
+
+			bool free = IsFree(block);
+			if (free)
+			{
+				// Free blocks are always merged
+				if (previousFree)
+					return false;
+
+				auto [firstLevelIndex, secondLevelIndex] = MapInsert(GetBlockSize(block));
+				if ((m_firstLevelBitmap & (1u << firstLevelIndex)) == 0 || (m_secondLevelBitmaps[firstLevelIndex] & (1u << secondLevelIndex)) == 0)
+					return false;
+
+				const BlockHeader* freeBlock = m_freeLists[firstLevelIndex][secondLevelIndex];
+				while (freeBlock && freeBlock != block)
+					freeBlock = reinterpret_cast<const FreeLinks*>(GetPayload(freeBlock))->next;
+
+				if (!freeBlock)
+					return false;
+			}
+			else if (GetBlockSize(block) == 0)
+				break; //< sentinel
+
+			previousFree = free;
+			previousBlock = block;
+		}
+
+		for (unsigned int firstLevelIndex = 0; firstLevelIndex < FirstLevelIndexCount; ++firstLevelIndex)
+		{
+			if (((m_firstLevelBitmap & (1u << firstLevelIndex)) != 0) != (m_secondLevelBitmaps[firstLevelIndex] != 0))
+				return false;
+
+			for (unsigned int secondLevelIndex = 0; secondLevelIndex < SecondLevelIndexCount; ++secondLevelIndex)
+			{
+				if (((m_secondLevelBitmaps[firstLevelIndex] & (1u << secondLevelIndex)) != 0) != (m_freeLists[firstLevelIndex][secondLevelIndex] != nullptr))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Frees a block of memory
+	*
+	* \param ptr Pointer returned by Allocate or Reallocate, can be null
+	*/
+	inline void TLSFAllocator::Free(void* ptr)
+	{
+		if (!ptr)
+			return;
+
+		BlockHeader* block = GetBlockFromPayload(ptr);
+		NazaraAssertMsg(!IsFree(block), "double free");
+
+		m_allocatedSize -= GetBlockSize(block);
+
+		SetFree(block, true);
+		SetPreviousFree(GetNextPhysicalBlock(block), true);
+
+		if (IsPreviousFree(block))
+		{
+			BlockHeader* previousBlock = block->previousPhysical;
+			RemoveFreeBlock(previousBlock);
+			AbsorbNextBlock(previousBlock, block);
+
+			block = previousBlock;
+		}
+
+		block = MergeWithNextFreeBlock(block);
+		InsertFreeBlock(block);
+	}
+
+	/*!
+	* \brief Gets the total size of allocated blocks
+	* \return Sum of the sizes of all allocated blocks, which may be bigger than requested sizes (block headers are not included)
+	*/
+	inline std::size_t TLSFAllocator::GetAllocatedSize() const
+	{
+		return m_allocatedSize;
+	}
+
+	/*!
+	* \brief Resizes a block of memory
+	* \return Pointer to the resized memory, or nullptr if it couldn't be resized (in which case the original block is left untouched)
+	*
+	* The block is resized in place if possible (shrinking or growing into a free neighbor), otherwise a new block is allocated and the content is copied.
+	*
+	* \param ptr Pointer returned by Allocate or Reallocate, if null this behaves like Allocate
+	* \param size New size of the allocation, if zero this behaves like Free
+	* \param alignment Alignment of the allocation, used only if the block has to be moved
+	*/
+	inline void* TLSFAllocator::Reallocate(void* ptr, std::size_t size, std::size_t alignment)
+	{
+		if (!ptr)
+			return Allocate(size, alignment);
+
+		if (size == 0)
+		{
+			Free(ptr);
+			return nullptr;
+		}
+
+		if (size > MaxAllocationSize)
+			return nullptr;
+
+		NazaraAssertMsg(PointerToInteger<std::uintptr_t>(ptr) % alignment == 0, "pointer is not aligned to the requested alignment");
+
+		BlockHeader* block = GetBlockFromPayload(ptr);
+		std::size_t currentSize = GetBlockSize(block);
+		std::size_t adjustedSize = AdjustSize(size);
+
+		if (adjustedSize > currentSize)
+		{
+			BlockHeader* nextBlock = GetNextPhysicalBlock(block);
+			if (!IsFree(nextBlock) || currentSize + HeaderSize + GetBlockSize(nextBlock) < adjustedSize)
+			{
+				void* newPtr = Allocate(size, alignment);
+				if (!newPtr)
+					return nullptr;
+
+				std::memcpy(newPtr, ptr, currentSize);
+				Free(ptr);
+
+				return newPtr;
+			}
+
+			// Grow in place by taking the next block
+			RemoveFreeBlock(nextBlock);
+			AbsorbNextBlock(block, nextBlock);
+			SetPreviousFree(GetNextPhysicalBlock(block), false);
+		}
+
+		TrimBlock(block, adjustedSize);
+		if (BlockHeader* remainingBlock = GetNextPhysicalBlock(block); IsFree(remainingBlock))
+		{
+			// Shrinking may have created a free block next to another one
+			SetPreviousFree(remainingBlock, false);
+
+			RemoveFreeBlock(remainingBlock);
+			remainingBlock = MergeWithNextFreeBlock(remainingBlock);
+			InsertFreeBlock(remainingBlock);
+		}
+
+		m_allocatedSize = m_allocatedSize - currentSize + GetBlockSize(block);
+
+		return ptr;
+	}
+
+	/*!
+	* \brief Retrieves the usable size of an allocation
+	* \return Size of the block, at least as big as the size which was requested
+	*
+	* \param ptr Pointer returned by Allocate or Reallocate
+	*/
+	inline std::size_t TLSFAllocator::GetAllocationSize(const void* ptr)
+	{
+		return GetBlockSize(GetBlockFromPayload(ptr));
+	}
+
+	inline auto TLSFAllocator::FindFreeBlock(std::size_t size) -> BlockHeader*
+	{
+		auto [firstLevelIndex, secondLevelIndex] = MapSearch(size);
+		if (firstLevelIndex >= FirstLevelIndexCount)
+			return nullptr;
+
+		// Look for a non-empty list of blocks in the same first level first, then at the next non-empty first level
+		UInt32 secondLevelMap = m_secondLevelBitmaps[firstLevelIndex] & (~UInt32(0) << secondLevelIndex);
+		if (secondLevelMap == 0)
+		{
+			UInt32 firstLevelMap = m_firstLevelBitmap & (~UInt32(0) << (firstLevelIndex + 1));
+			if (firstLevelMap == 0)
+				return nullptr;
+
+			firstLevelIndex = FindFirstBit(firstLevelMap) - 1;
+			secondLevelMap = m_secondLevelBitmaps[firstLevelIndex];
+		}
+
+		secondLevelIndex = FindFirstBit(secondLevelMap) - 1;
+
+		BlockHeader* block = m_freeLists[firstLevelIndex][secondLevelIndex];
+		assert(block && GetBlockSize(block) >= size);
+
+		RemoveFreeBlock(block, firstLevelIndex, secondLevelIndex);
+
+		return block;
+	}
+
+	inline void TLSFAllocator::InsertFreeBlock(BlockHeader* block)
+	{
+		assert(IsFree(block));
+
+		auto [firstLevelIndex, secondLevelIndex] = MapInsert(GetBlockSize(block));
+
+		BlockHeader*& head = m_freeLists[firstLevelIndex][secondLevelIndex];
+
+		FreeLinks* links = reinterpret_cast<FreeLinks*>(GetPayload(block));
+		links->next = head;
+		links->previous = nullptr;
+		if (head)
+			reinterpret_cast<FreeLinks*>(GetPayload(head))->previous = block;
+
+		head = block;
+
+		m_firstLevelBitmap |= UInt32(1) << firstLevelIndex;
+		m_secondLevelBitmaps[firstLevelIndex] |= UInt32(1) << secondLevelIndex;
+	}
+
+	inline void TLSFAllocator::MarkAsUsed(BlockHeader* block)
+	{
+		SetFree(block, false);
+		SetPreviousFree(GetNextPhysicalBlock(block), false);
+	}
+
+	inline auto TLSFAllocator::MergeWithNextFreeBlock(BlockHeader* block) -> BlockHeader*
+	{
+		BlockHeader* nextBlock = GetNextPhysicalBlock(block);
+		if (IsFree(nextBlock))
+		{
+			RemoveFreeBlock(nextBlock);
+			AbsorbNextBlock(block, nextBlock);
+		}
+
+		return block;
+	}
+
+	inline void TLSFAllocator::RemoveFreeBlock(BlockHeader* block)
+	{
+		auto [firstLevelIndex, secondLevelIndex] = MapInsert(GetBlockSize(block));
+		RemoveFreeBlock(block, firstLevelIndex, secondLevelIndex);
+	}
+
+	inline void TLSFAllocator::RemoveFreeBlock(BlockHeader* block, unsigned int firstLevelIndex, unsigned int secondLevelIndex)
+	{
+		FreeLinks* links = reinterpret_cast<FreeLinks*>(GetPayload(block));
+		if (links->previous)
+			reinterpret_cast<FreeLinks*>(GetPayload(links->previous))->next = links->next;
+
+		if (links->next)
+			reinterpret_cast<FreeLinks*>(GetPayload(links->next))->previous = links->previous;
+
+		BlockHeader*& head = m_freeLists[firstLevelIndex][secondLevelIndex];
+		if (head == block)
+		{
+			head = links->next;
+			if (!head)
+			{
+				m_secondLevelBitmaps[firstLevelIndex] &= ~(UInt32(1) << secondLevelIndex);
+				if (m_secondLevelBitmaps[firstLevelIndex] == 0)
+					m_firstLevelBitmap &= ~(UInt32(1) << firstLevelIndex);
+			}
+		}
+	}
+
+	inline void TLSFAllocator::TrimBlock(BlockHeader* block, std::size_t size)
+	{
+		// Give back the end of the block if it's big enough to make another block
+		if (GetBlockSize(block) >= size + HeaderSize + MinBlockSize)
+		{
+			BlockHeader* remainingBlock = SplitBlock(block, size);
+			SetFree(remainingBlock, true);
+			SetPreviousFree(GetNextPhysicalBlock(remainingBlock), true);
+
+			InsertFreeBlock(remainingBlock);
+		}
+	}
+
+	inline void TLSFAllocator::AbsorbNextBlock(BlockHeader* block, BlockHeader* nextBlock)
+	{
+		SetBlockSize(block, GetBlockSize(block) + HeaderSize + GetBlockSize(nextBlock));
+		GetNextPhysicalBlock(block)->previousPhysical = block;
+	}
+
+	inline std::size_t TLSFAllocator::AdjustSize(std::size_t size)
+	{
+		return std::max(AlignPow2(size, Alignment), MinBlockSize);
+	}
+
+	inline auto TLSFAllocator::GetBlockFromPayload(const void* ptr) -> BlockHeader*
+	{
+		return reinterpret_cast<BlockHeader*>(const_cast<std::byte*>(static_cast<const std::byte*>(ptr)) - HeaderSize);
+	}
+
+	inline std::size_t TLSFAllocator::GetBlockSize(const BlockHeader* block)
+	{
+		return block->sizeAndFlags & ~FlagMask;
+	}
+
+	inline auto TLSFAllocator::GetNextPhysicalBlock(const BlockHeader* block) -> BlockHeader*
+	{
+		return reinterpret_cast<BlockHeader*>(GetPayload(block) + GetBlockSize(block));
+	}
+
+	inline std::byte* TLSFAllocator::GetPayload(const BlockHeader* block)
+	{
+		return const_cast<std::byte*>(reinterpret_cast<const std::byte*>(block)) + HeaderSize;
+	}
+
+	inline bool TLSFAllocator::IsFree(const BlockHeader* block)
+	{
+		return block->sizeAndFlags & FreeFlag;
+	}
+
+	inline bool TLSFAllocator::IsPreviousFree(const BlockHeader* block)
+	{
+		return block->sizeAndFlags & PreviousFreeFlag;
+	}
+
+	inline std::pair<unsigned int, unsigned int> TLSFAllocator::MapInsert(std::size_t size)
+	{
+		if (size < SmallBlockSize)
+		{
+			// Small blocks are linearly split in the first list
+			return { 0u, static_cast<unsigned int>(size / (SmallBlockSize / SecondLevelIndexCount)) };
+		}
+
+		unsigned int mostSignificantBit = FindLastBit(size) - 1;
+		unsigned int secondLevelIndex = static_cast<unsigned int>(size >> (mostSignificantBit - SecondLevelIndexCountLog2)) ^ SecondLevelIndexCount;
+		unsigned int firstLevelIndex = mostSignificantBit - (FirstLevelShift - 1);
+
+		return { firstLevelIndex, secondLevelIndex };
+	}
+
+	inline std::pair<unsigned int, unsigned int> TLSFAllocator::MapSearch(std::size_t size)
+	{
+		// Round up to the next list so that any block it holds is big enough
+		if (size >= SmallBlockSize)
+			size += (std::size_t(1) << ((FindLastBit(size) - 1) - SecondLevelIndexCountLog2)) - 1;
+
+		return MapInsert(size);
+	}
+
+	inline void TLSFAllocator::SetBlockSize(BlockHeader* block, std::size_t size)
+	{
+		assert((size & FlagMask) == 0);
+		block->sizeAndFlags = size | (block->sizeAndFlags & FlagMask);
+	}
+
+	inline void TLSFAllocator::SetFree(BlockHeader* block, bool free)
+	{
+		if (free)
+			block->sizeAndFlags |= FreeFlag;
+		else
+			block->sizeAndFlags &= ~FreeFlag;
+	}
+
+	inline void TLSFAllocator::SetPreviousFree(BlockHeader* block, bool free)
+	{
+		if (free)
+			block->sizeAndFlags |= PreviousFreeFlag;
+		else
+			block->sizeAndFlags &= ~PreviousFreeFlag;
+	}
+
+	inline auto TLSFAllocator::SplitBlock(BlockHeader* block, std::size_t size) -> BlockHeader*
+	{
+		assert(GetBlockSize(block) >= size + HeaderSize + MinBlockSize);
+
+		BlockHeader* remainingBlock = reinterpret_cast<BlockHeader*>(GetPayload(block) + size);
+		remainingBlock->sizeAndFlags = (GetBlockSize(block) - size - HeaderSize) | FreeFlag;
+		remainingBlock->previousPhysical = block;
+		SetPreviousFree(remainingBlock, IsFree(block));
+
+		SetBlockSize(block, size);
+
+		GetNextPhysicalBlock(remainingBlock)->previousPhysical = remainingBlock;
+
+		return remainingBlock;
+	}
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARAUTILS_TASKSCHEDULER_HPP
+#define NAZARAUTILS_TASKSCHEDULER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/MPMCQueue.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Chase-Lev work-stealing deque (bounded), the owner pushes and pops at the bottom while thieves steal from the top
+		template<typename T, std::size_t Capacity>
+		class WorkStealingQueue
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			static_assert(Capacity > 0 && IsPow2(Capacity));
+
+			public:
+				WorkStealingQueue();
+
+				bool Push(T value);
+				bool Pop(T& value);
+				bool Steal(T& value);
+
+			private:
+				static constexpr std::ptrdiff_t Mask = Capacity - 1;
+
+				alignas(CacheLineSize) std::atomic<std::ptrdiff_t> m_top;
+				alignas(CacheLineSize) std::atomic<std::ptrdiff_t> m_bottom;
+				std::array<std::atomic<T>, Capacity> m_buffer;
+		};
+	}
+
+	class TaskScheduler
+	{
+		public:
+			class Counter;
+			class Task;
+
+			explicit TaskScheduler(std::size_t workerCount = 0);
+			TaskScheduler(const TaskScheduler&) = delete;
+			TaskScheduler(TaskScheduler&&) = delete;
+			~TaskScheduler();
+
+			template<typename F> void AddTask(F&& func, Counter* counter = nullptr);
+
+			template<typename F> Task* CreateTask(F&& func, Counter* counter = nullptr);
+
+			std::size_t GetWorkerCount() const;
+
+			void SetContinuation(Task* task, Task* continuation);
+			void Submit(Task* task);
+
+			void WaitFor(const Counter& counter);
+
+			void operator()(std::size_t jobCount, FunctionRef<void(std::size_t)> job);
+
+			TaskScheduler& operator=(const TaskScheduler&) = delete;
+			TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+			static constexpr std::size_t TaskFunctionCapacity = 6 * sizeof(void*);
+
+			class Counter
+			{
+				friend TaskScheduler;
+
+				public:
+					Counter();
+					Counter(const Counter&) = delete;
+					Counter(Counter&&) = delete;
+					~Counter();
+
+					bool IsDone() const;
+
+					Counter& operator=(const Counter&) = delete;
+					Counter& operator=(Counter&&) = delete;
+
+				private:
+					std::atomic<std::size_t> m_pendingCount;
+			};
+
+			class Task
+			{
+				friend TaskScheduler;
+
+				public:
+					template<typename F> Task(F&& func, Counter* counter, std::size_t ownerIndex);
+					Task(const Task&) = delete;
+					Task(Task&&) = delete;
+					~Task() = default;
+
+					Task& operator=(const Task&) = delete;
+					Task& operator=(Task&&) = delete;
+
+				private:
+					InplaceFunction<void(), TaskFunctionCapacity> m_function;
+					Counter* m_counter;
+					Task* m_continuation;
+					Task* m_nextFree;
+					std::atomic<std::size_t> m_dependencyCount; //< predecessors + one for Submit
+					std::size_t m_ownerIndex;
+					std::size_t m_poolIndex;
+			};
+
+		private:
+			struct TaskPool;
+			struct ThreadContext;
+
+			template<typename F> Task* AllocateTask(F&& func, Counter* counter);
+			Task* FetchTask();
+			void FreeTask(Task* task);
+			void PushTask(Task* task);
+			void ReleaseDependency(Task* task);
+			void RunTask(Task* task);
+			void WakeWorker();
+			void WorkerLoop(std::size_t workerIndex);
+
+			static ThreadContext& GetThreadContext();
+
+			static constexpr std::size_t InjectionQueueCapacity = 1024;
+			static constexpr std::size_t TaskPoolBlockSize = 256;
+			static constexpr std::size_t WorkerQueueCapacity = 1024;
+
+			struct alignas(CacheLineSize) TaskPool
+			{
+				TaskPool();
+
+				MemoryPool<Task> pool;
+				std::atomic<Task*> remoteFreeList; //< tasks freed by other threads, released by the owner on its next allocation
+			};
+
+			struct alignas(CacheLineSize) Worker
+			{
+				Detail::WorkStealingQueue<Task*, WorkerQueueCapacity> queue;
+				TaskPool taskPool;
+				std::thread thread;
+			};
+
+			struct ThreadContext
+			{
+				TaskScheduler* scheduler = nullptr;
+				std::size_t workerIndex = 0;
+				UInt32 randomState = 0x9E3779B9;
+			};
+
+			std::condition_variable m_wakeCondition;
+			std::mutex m_externalMutex;
+			std::mutex m_wakeMutex;
+			std::size_t m_workerCount;
+			std::unique_ptr<Worker[]> m_workers;
+			MPMCQueue<Task*, InjectionQueueCapacity> m_injectionQueue;
+			TaskPool m_externalTaskPool; //< used by non-worker threads, protected by m_externalMutex
+			alignas(CacheLineSize) std::atomic<std::size_t> m_pendingTaskCount; //< tasks pushed but not yet fetched
+			alignas(CacheLineSize) std::atomic<std::size_t> m_sleepingWorkerCount;
+			std::atomic<UInt64> m_wakeEpoch;
+			std::atomic_bool m_running;
+	};
+}
+
+#include <NazaraUtils/TaskScheduler.inl>
+
+#endif // NAZARAUTILS_TASKSCHEDULER_HPP
@@ -0,0 +1,444 @@
+// Copyright (C) 2026 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Utility Library"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Assert.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename T, std::size_t Capacity>
+		WorkStealingQueue<T, Capacity>::WorkStealingQueue() :
+		m_top(0),
+		m_bottom(0)
+		{
+		}
+
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingQueue<T, Capacity>::Push(T value)
+		{
+			std::ptrdiff_t bottom = m_bottom.load(std::memory_order_relaxed);
+			std::ptrdiff_t top = m_top.load(std::memory_order_acquire);
+			if (bottom - top >= static_cast<std::ptrdiff_t>(Capacity))
+				return false;
+
+			m_buffer[bottom & Mask].store(value, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingQueue<T, Capacity>::Pop(T& value)
+		{
+			// Every store to bottom is a release so thieves reading any of them see the values pushed before
+			std::ptrdiff_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			std::ptrdiff_t top = m_top.load(std::memory_order_relaxed);
+			if (top > bottom)
+			{
+				// Empty
+				m_bottom.store(bottom + 1, std::memory_order_release);
+				return false;
+			}
+
+			value = m_buffer[bottom & Mask].load(std::memory_order_relaxed);
+			if (top != bottom)
+				return true;
+
+			// Last element, race against thieves
+			bool taken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_release);
+
+			return taken;
+		}
+
+		template<typename T, std::size_t Capacity>
+		bool WorkStealingQueue<T, Capacity>::Steal(T& value)
+		{
+			std::ptrdiff_t top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::ptrdiff_t bottom = m_bottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return false;
+
+			value = m_buffer[top & Mask].load(std::memory_order_relaxed);
+			return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \ingroup utils
+	* \class TaskScheduler
+	* \brief Work-stealing thread pool running small tasks, with continuations and counters to wait on
+	*
+	* Each worker owns a Chase-Lev deque: tasks created by a worker are pushed on its own deque (and executed in LIFO order),
+	* idle workers steal from the other end of the deques of other workers. Tasks created by other threads go through a shared injection queue.
+	*
+	* Tasks are allocated in per-worker MemoryPool blocks (a task freed by another thread is handed back to its owner through a lock-free list)
+	* and their callable is stored inline, its size being limited to TaskFunctionCapacity.
+	*
+	* Waiting on a counter (see WaitFor) executes pending tasks until the counter reaches zero, so tasks can wait on other tasks without blocking a worker.
+	*
+	* The scheduler can also be used as an executor for functions taking a job count and a job callback (such as MemoryPool::ParallelForEach).
+	*/
+
+	/*!
+	* \brief Starts the worker threads
+	*
+	* \param workerCount Number of worker threads, zero to use one per hardware thread
+	*/
+	inline TaskScheduler::TaskScheduler(std::size_t workerCount) :
+	m_workerCount((workerCount > 0) ? workerCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1)),
+	m_pendingTaskCount(0),
+	m_sleepingWorkerCount(0),
+	m_wakeEpoch(0),
+	m_running(true)
+	{
+		m_workers = std::make_unique<Worker[]>(m_workerCount);
+		for (std::size_t i = 0; i < m_workerCount; ++i)
+			m_workers[i].thread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+	}
+
+	/*!
+	* \brief Runs every pending task and stops the worker threads
+	*
+	* \remark Tasks which are still waiting on their dependencies are destroyed without being executed
+	*/
+	inline TaskScheduler::~TaskScheduler()
+	{
+		{
+			std::lock_guard lock(m_wakeMutex);
+			m_running = false;
+			m_wakeEpoch++;
+		}
+		m_wakeCondition.notify_all();
+
+		for (std::size_t i = 0; i < m_workerCount; ++i)
+			m_workers[i].thread.join();
+	}
+
+	/*!
+	* \brief Creates a task and submits it right away
+	*
+	* \param func Callable to execute, must fit in TaskFunctionCapacity bytes
+	* \param counter Optional counter incremented now and decremented once the task has been executed
+	*/
+	template<typename F>
+	void TaskScheduler::AddTask(F&& func, Counter* counter)
+	{
+		Submit(CreateTask(std::forward<F>(func), counter));
+	}
+
+	/*!
+	* \brief Creates a task without submitting it, allowing continuations to be set
+	* \return Task which will be executed once submitted and once all its predecessors have been executed
+	*
+	* \param func Callable to execute, must fit in TaskFunctionCapacity bytes
+	* \param counter Optional counter incremented now and decremented once the task has been executed
+	*
+	* \see SetContinuation
+	* \see Submit
+	*/
+	template<typename F>
+	auto TaskScheduler::CreateTask(F&& func, Counter* counter) -> Task*
+	{
+		if (counter)
+			counter->m_pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+		return AllocateTask(std::forward<F>(func), counter);
+	}
+
+	inline std::size_t TaskScheduler::GetWorkerCount() const
+	{
+		return m_workerCount;
+	}
+
+	/*!
+	* \brief Sets the task to execute once a task has been executed
+	*
+	* A task has at most one continuation, but a continuation can have any number of predecessors (it will be executed after all of them).
+	*
+	* \param task Predecessor task, which must not have been submitted yet
+	* \param continuation Task to execute once all its predecessors have been executed (and itself submitted)
+	*/
+	inline void TaskScheduler::SetContinuation(Task* task, Task* continuation)
+	{
+		NazaraAssert(task);
+		NazaraAssert(continuation);
+		NazaraAssertMsg(!task->m_continuation, "task already has a continuation");
+
+		continuation->m_dependencyCount.fetch_add(1, std::memory_order_relaxed);
+		task->m_continuation = continuation;
+	}
+
+	/*!
+	* \brief Submits a task created by CreateTask, it will be queued as soon as all its predecessors have been executed
+	*/
+	inline void TaskScheduler::Submit(Task* task)
+	{
+		NazaraAssert(task);
+		ReleaseDependency(task);
+	}
+
+	/*!
+	* \brief Executes pending tasks until a counter reaches zero
+	*
+	* Can be called from any thread, including from a task.
+	*/
+	inline void TaskScheduler::WaitFor(const Counter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (Task* task = FetchTask())
+				RunTask(task);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	/*!
+	* \brief Executes a job a number of times in parallel (one task per job index) and waits for all of them
+	*/
+	inline void TaskScheduler::operator()(std::size_t jobCount, FunctionRef<void(std::size_t)> job)
+	{
+		Counter counter;
+		for (std::size_t i = 0; i < jobCount; ++i)
+			AddTask([job, i] { job(i); }, &counter);
+
+		WaitFor(counter);
+	}
+
+	template<typename F>
+	auto TaskScheduler::AllocateTask(F&& func, Counter* counter) -> Task*
+	{
+		auto Allocate = [&](TaskPool& taskPool, std::size_t ownerIndex)
+		{
+			// Release tasks freed by other threads
+			Task* freeTask = taskPool.remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+			while (freeTask)
+			{
+				Task* nextTask = freeTask->m_nextFree;
+				taskPool.pool.Free(freeTask->m_poolIndex);
+				freeTask = nextTask;
+			}
+
+			std::size_t poolIndex;
+			Task* task = taskPool.pool.Allocate(poolIndex, std::forward<F>(func), counter, ownerIndex);
+			task->m_poolIndex = poolIndex;
+
+			return task;
+		};
+
+		ThreadContext& context = GetThreadContext();
+		if (context.scheduler == this)
+			return Allocate(m_workers[context.workerIndex].taskPool, context.workerIndex);
+
+		std::lock_guard lock(m_externalMutex);
+		return Allocate(m_externalTaskPool, m_workerCount);
+	}
+
+	inline auto TaskScheduler::FetchTask() -> Task*
+	{
+		ThreadContext& context = GetThreadContext();
+
+		Task* task = nullptr;
+		bool isWorker = (context.scheduler == this);
+		if ((isWorker && m_workers[context.workerIndex].queue.Pop(task)) || m_injectionQueue.TryPop(task))
+		{
+			m_pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+			return task;
+		}
+
+		// Steal from a random worker
+		context.randomState ^= context.randomState << 13;
+		context.randomState ^= context.randomState >> 17;
+		context.randomState ^= context.randomState << 5;
+
+		std::size_t firstVictim = context.randomState % m_workerCount;
+		for (std::size_t i = 0; i < m_workerCount; ++i)
+		{
+			std::size_t victimIndex = (firstVictim + i) % m_workerCount;
+			if (isWorker && victimIndex == context.workerIndex)
+				continue;
+
+			if (m_workers[victimIndex].queue.Steal(task))
+			{
+				m_pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+				return task;
+			}
+		}
+
+		return nullptr;
+	}
+
+	inline void TaskScheduler::FreeTask(Task* task)
+	{
+		ThreadContext& context = GetThreadContext();
+		if (context.scheduler == this && context.workerIndex == task->m_ownerIndex)
+		{
+			m_workers[context.workerIndex].taskPool.pool.Free(task->m_poolIndex);
+			return;
+		}
+
+		TaskPool& taskPool = (task->m_ownerIndex < m_workerCount) ? m_workers[task->m_ownerIndex].taskPool : m_externalTaskPool;
+
+		Task* head = taskPool.remoteFreeList.load(std::memory_order_relaxed);
+		do
+		{
+			task->m_nextFree = head;
+		}
+		while (!taskPool.remoteFreeList.compare_exchange_weak(head, task, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	inline void TaskScheduler::PushTask(Task* task)
+	{
+		// Incremented before the push so that a worker going to sleep either sees the task or is woken up
+		m_pendingTaskCount.fetch_add(1);
+
+		ThreadContext& context = GetThreadContext();
+		bool pushed;
+		if (context.scheduler == this)
+			pushed = m_workers[context.workerIndex].queue.Push(task);
+		else
+			pushed = m_injectionQueue.TryPush(task);
+
+		if (!pushed)
+		{
+			// Queue is full, execute the task right away
+			m_pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+			RunTask(task);
+			return;
+		}
+
+		if (m_sleepingWorkerCount.load() > 0)
+			WakeWorker();
+	}
+
+	inline void TaskScheduler::ReleaseDependency(Task* task)
+	{
+		if (task->m_dependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			PushTask(task);
+	}
+
+	inline void TaskScheduler::RunTask(Task* task)
+	{
+		task->m_function();
+		task->m_function.Reset(); //< release captured resources right away
+
+		if (task->m_continuation)
+			ReleaseDependency(task->m_continuation);
+
+		Counter* counter = task->m_counter;
+		FreeTask(task);
+
+		if (counter)
+			counter->m_pendingCount.fetch_sub(1, std::memory_order_release);
+	}
+
+	inline void TaskScheduler::WakeWorker()
+	{
+		{
+			std::lock_guard lock(m_wakeMutex);
+			m_wakeEpoch++;
+		}
+		m_wakeCondition.notify_one();
+	}
+
+	inline void TaskScheduler::WorkerLoop(std::size_t workerIndex)
+	{
+		ThreadContext& context = GetThreadContext();
+		context.scheduler = this;
+		context.workerIndex = workerIndex;
+		context.randomState = static_cast<UInt32>(workerIndex * 0x9E3779B9 + 1);
+
+		constexpr unsigned int SpinCount = 64;
+
+		unsigned int idleCount = 0;
+		for (;;)
+		{
+			if (Task* task = FetchTask())
+			{
+				RunTask(task);
+				idleCount = 0;
+				continue;
+			}
+
+			if (idleCount++ < SpinCount)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Go to sleep until a task is pushed, the epoch is read before checking for pending tasks so that no wake up can be missed
+			m_sleepingWorkerCount.fetch_add(1);
+			UInt64 wakeEpoch = m_wakeEpoch.load();
+			if (m_pendingTaskCount.load() == 0)
+			{
+				if (!m_running.load())
+				{
+					m_sleepingWorkerCount.fetch_sub(1);
+					break;
+				}
+
+				std::unique_lock lock(m_wakeMutex);
+				m_wakeCondition.wait(lock, [&] { return m_wakeEpoch.load() != wakeEpoch || !m_running.load(); });
+			}
+			m_sleepingWorkerCount.fetch_sub(1);
+
+			idleCount = 0;
+		}
+
+		context.scheduler = nullptr;
+	}
+
+	inline auto TaskScheduler::GetThreadContext() -> ThreadContext&
+	{
+		thread_local ThreadContext context;
+		return context;
+	}
+
+
+	inline TaskScheduler::Counter::Counter() :
+	m_pendingCount(0)
+	{
+	}
+
+	inline TaskScheduler::Counter::~Counter()
+	{
+		NazaraAssertMsg(IsDone(), "counter destroyed while tasks are still pending");
+	}
+
+	/*!
+	* \brief Checks if every task associated with this counter has been executed
+	*/
+	inline bool TaskScheduler::Counter::IsDone() const
+	{
+		return m_pendingCount.load(std::memory_order_acquire) == 0;
+	}
+
+
+	template<typename F>
+	TaskScheduler::Task::Task(F&& func, Counter* counter, std::size_t ownerIndex) :
+	m_function(std::forward<F>(func)),
+	m_counter(counter),
+	m_continuation(nullptr),
+	m_nextFree(nullptr),
+	m_dependencyCount(1),
+	m_ownerIndex(ownerIndex),
+	m_poolIndex(0)
+	{
+	}
+
+
+	inline TaskScheduler::TaskPool::TaskPool() :
+	pool(TaskPoolBlockSize),
+	remoteFreeList(nullptr)
+	{
+	}
+}
@@ -8,6 +8,7 @@
 #define NAZARAUTILS_TYPETRAITS_HPP
 
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace Nz
@@ -98,6 +99,20 @@ namespace Nz
 
 	/************************************************************************/
 
+	// Trivially relocatable types can be moved to another memory location with a memcpy, ending the lifetime of the source object without calling its destructor
+	// This is true for trivially copyable types, other types can opt in by specializing this struct (see std::unique_ptr)
+	template<typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	template<typename T, typename Deleter> struct IsTriviallyRelocatable<std::unique_ptr<T, Deleter>> : IsTriviallyRelocatable<Deleter> {};
+	template<typename T> struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type {};
+	template<typename T> struct IsTriviallyRelocatable<std::weak_ptr<T>> : std::true_type {};
+
+	template<typename T>
+	constexpr bool IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
+
+	/************************************************************************/
+
 	template<typename T, typename... Args>
 	struct IsFirstType : std::false_type {};
 
@@ -1,12 +1,38 @@
 #include <NazaraUtils/Algorithm.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <random>
 #include <string>
+#include <vector>
 
 struct A {};
 struct B : A {};
 
+template<typename T>
+void CheckRadixSort(std::size_t count)
+{
+	std::mt19937_64 randomEngine(42);
+
+	std::vector<T> values(count);
+	for (T& value : values)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+			value = std::uniform_real_distribution<T>(-1000, 1000)(randomEngine);
+		else
+			value = static_cast<T>(randomEngine());
+	}
+
+	std::vector<T> expected = values;
+	std::sort(expected.begin(), expected.end());
+
+	std::vector<T> buffer(count);
+	Nz::RadixSort(values.data(), values.size(), buffer.data());
+	CHECK(values == expected);
+}
+
 SCENARIO("Algorithm", "[Algorithm]")
 {
 	WHEN("Testing IntegerToPointer and PointerToInteger")
@@ -64,4 +90,64 @@ SCENARIO("Algorithm", "[Algorithm]")
 		CHECK(Nz::SafeCast<B*>(nullptr) == nullptr);
 
 	}
+
+	WHEN("Testing RadixSort")
+	{
+		for (std::size_t count : { 0, 1, 10, 1000 })
+		{
+			CheckRadixSort<Nz::UInt8>(count);
+			CheckRadixSort<Nz::UInt16>(count);
+			CheckRadixSort<Nz::UInt32>(count);
+			CheckRadixSort<Nz::UInt64>(count);
+			CheckRadixSort<Nz::Int8>(count);
+			CheckRadixSort<Nz::Int32>(count);
+			CheckRadixSort<Nz::Int64>(count);
+			CheckRadixSort<float>(count);
+			CheckRadixSort<double>(count);
+		}
+
+		std::vector<float> specialValues = { 0.f, -0.f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min(), -1.f, 1.f };
+		specialValues.resize(100, 0.5f);
+		std::vector<float> buffer(specialValues.size());
+		Nz::RadixSort(specialValues.data(), specialValues.size(), buffer.data());
+		CHECK(std::is_sorted(specialValues.begin(), specialValues.end()));
+		CHECK(specialValues.front() == -std::numeric_limits<float>::infinity());
+		CHECK(specialValues.back() == std::numeric_limits<float>::infinity());
+
+		AND_THEN("Sorting by key is stable")
+		{
+			struct Entity
+			{
+				Nz::UInt64 renderKey;
+				int id;
+			};
+
+			std::vector<Entity> entities;
+			for (int i = 0; i < 500; ++i)
+				entities.push_back({ Nz::UInt64(i % 7) << 40, i });
+
+			std::vector<Entity> entityBuffer(entities.size());
+			Nz::RadixSort(entities.data(), entities.size(), entityBuffer.data(), [](const Entity& entity) { return entity.renderKey; });
+
+			CHECK(std::is_sorted(entities.begin(), entities.end(), [](const Entity& lhs, const Entity& rhs) { return lhs.renderKey < rhs.renderKey || (lhs.renderKey == rhs.renderKey && lhs.id < rhs.id); }));
+		}
+
+		AND_THEN("Sorting by an enum member")
+		{
+			enum class Layer : Nz::Int16
+			{
+				Background = -10,
+				World = 0,
+				UI = 10
+			};
+
+			std::vector<std::pair<Layer, std::string>> layers = { { Layer::UI, "ui" }, { Layer::World, "world" }, { Layer::Background, "background" } };
+			std::vector<std::pair<Layer, std::string>> layerBuffer(layers.size());
+			Nz::RadixSort(layers.data(), layers.size(), layerBuffer.data(), &std::pair<Layer, std::string>::first);
+
+			CHECK(layers[0].second == "background");
+			CHECK(layers[1].second == "world");
+			CHECK(layers[2].second == "ui");
+		}
+	}
 }
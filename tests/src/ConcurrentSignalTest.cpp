@@ -0,0 +1,154 @@
+#include <NazaraUtils/ConcurrentSignal.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct Counter
+	{
+		void Add(int value)
+		{
+			total += value;
+		}
+
+		std::atomic_int total{ 0 };
+	};
+
+	int IncrementAndGet(int* value)
+	{
+		return ++*value;
+	}
+}
+
+SCENARIO("ConcurrentSignal", "[CORE][CONCURRENTSIGNAL]")
+{
+	GIVEN("A concurrent signal")
+	{
+		Nz::ConcurrentSignal<int> signal;
+
+		WHEN("We connect different callbacks")
+		{
+			Counter counter;
+			auto connection = signal.Connect(counter, &Counter::Add);
+			signal.Connect([&](int value) { counter.total += value * 10; });
+
+			std::array<int, 32> bigCapture = {};
+			bigCapture[31] = 100;
+			signal.Connect([&counter, bigCapture](int value) { counter.total += value * bigCapture[31]; });
+
+			signal(1);
+			CHECK(counter.total == 111);
+
+			connection.Disconnect();
+			CHECK(!connection.IsConnected());
+
+			signal(1);
+			CHECK(counter.total == 221);
+
+			signal.Clear();
+			signal(1);
+			CHECK(counter.total == 221);
+		}
+
+		WHEN("We connect and disconnect while emitting")
+		{
+			int callCount = 0;
+			Nz::ConcurrentSignal<int>::Connection selfConnection;
+			Nz::ConcurrentSignal<int>::Connection newConnection;
+
+			auto sharedValue = std::make_shared<int>(42);
+			selfConnection = signal.Connect([&, sharedValue](int)
+			{
+				callCount++;
+				CHECK(*sharedValue == 42); //< callback is still alive while running
+				selfConnection.Disconnect();
+				CHECK(*sharedValue == 42);
+
+				newConnection = signal.Connect([&](int) { callCount++; });
+			});
+
+			signal(0);
+			CHECK(callCount == 1);
+			CHECK(!selfConnection.IsConnected());
+			CHECK(newConnection.IsConnected());
+			CHECK(sharedValue.use_count() == 1);
+
+			signal(0);
+			CHECK(callCount == 2);
+		}
+
+		WHEN("We connect callbacks returning a value")
+		{
+			Nz::ConcurrentSignal<int*> otherSignal;
+			otherSignal.Connect(&IncrementAndGet);
+			otherSignal.Connect([](int* value) { return *value += 10; });
+
+			int value = 0;
+			otherSignal(&value);
+			CHECK(value == 11);
+		}
+
+		WHEN("The signal is destroyed before its connections")
+		{
+			Nz::ConcurrentSignal<int>::Connection connection;
+			{
+				Nz::ConcurrentSignal<int> otherSignal;
+				connection = otherSignal.Connect([](int) {});
+				CHECK(connection.IsConnected());
+
+				Nz::ConcurrentSignal<int>::ConnectionGuard guard(otherSignal.Connect([](int) {}));
+				CHECK(guard.IsConnected());
+			}
+
+			CHECK(!connection.IsConnected());
+			connection.Disconnect();
+		}
+	}
+
+	GIVEN("Multiple threads emitting while others connect and disconnect")
+	{
+		constexpr std::size_t EmitterCount = 3;
+		constexpr std::size_t EmitCount = 2000;
+		constexpr std::size_t ConnectCount = 500;
+
+		Nz::ConcurrentSignal<int> signal;
+
+		std::atomic_int persistentCallCount(0);
+		signal.Connect([&](int value) { persistentCallCount += value; });
+
+		std::atomic_int temporaryCallCount(0);
+
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < EmitterCount; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (std::size_t j = 0; j < EmitCount; ++j)
+					signal(1);
+			});
+		}
+
+		threads.emplace_back([&]
+		{
+			auto sharedValue = std::make_shared<int>(1);
+			for (std::size_t i = 0; i < ConnectCount; ++i)
+			{
+				Nz::ConcurrentSignal<int>::ConnectionGuard guard = signal.Connect([&, sharedValue](int value)
+				{
+					temporaryCallCount += value * *sharedValue;
+				});
+				std::this_thread::yield();
+			}
+		});
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		CHECK(persistentCallCount == EmitterCount * EmitCount);
+		CHECK(temporaryCallCount <= int(EmitterCount * EmitCount));
+	}
+}
@@ -0,0 +1,239 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/FixedRingBuffer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+template<typename T>
+std::vector<int> CollectSegments(const T& ringBuffer)
+{
+	std::vector<int> values;
+	for (const auto& segment : ringBuffer.GetSegments())
+		values.insert(values.end(), segment.data, segment.data + segment.size);
+
+	return values;
+}
+
+SCENARIO("FixedRingBuffer", "[CORE][FIXEDRINGBUFFER]")
+{
+	GIVEN("A ring buffer of eight integers")
+	{
+		Nz::FixedRingBuffer<int, 8> ringBuffer;
+
+		CHECK(ringBuffer.empty());
+		CHECK(ringBuffer.capacity() == 8);
+		CHECK(ringBuffer.max_size() == 8);
+
+		WHEN("Pushing at both ends")
+		{
+			ringBuffer.push_back(2);
+			ringBuffer.push_back(3);
+			ringBuffer.push_front(1);
+			ringBuffer.emplace_front(0);
+
+			CHECK(ringBuffer.size() == 4);
+			CHECK(ringBuffer.front() == 0);
+			CHECK(ringBuffer.back() == 3);
+
+			std::array<int, 4> expectedValues = { 0, 1, 2, 3 };
+			CHECK(std::equal(ringBuffer.begin(), ringBuffer.end(), expectedValues.begin(), expectedValues.end()));
+			CHECK(std::equal(ringBuffer.rbegin(), ringBuffer.rend(), expectedValues.rbegin(), expectedValues.rend()));
+
+			THEN("Elements wrap around the end of the buffer and are split in two segments")
+			{
+				auto segments = ringBuffer.GetSegments();
+				CHECK(segments[0].size == 2);
+				CHECK(segments[1].size == 2);
+				CHECK(segments[1].data[0] == 2);
+				CHECK(CollectSegments(ringBuffer) == std::vector<int>{ 0, 1, 2, 3 });
+			}
+
+			THEN("Popping at both ends")
+			{
+				ringBuffer.pop_front();
+				ringBuffer.pop_back();
+
+				CHECK(ringBuffer.size() == 2);
+				CHECK(ringBuffer.front() == 1);
+				CHECK(ringBuffer.back() == 2);
+			}
+		}
+
+		WHEN("Using it as a FIFO queue for longer than its capacity")
+		{
+			int nextValue = 0;
+			int expectedValue = 0;
+			for (int i = 0; i < 100; ++i)
+			{
+				while (!ringBuffer.full())
+					ringBuffer.push_back(nextValue++);
+
+				for (int j = 0; j < 3; ++j)
+				{
+					CHECK(ringBuffer.front() == expectedValue++);
+					ringBuffer.pop_front();
+				}
+			}
+
+			CHECK(ringBuffer.size() == 5);
+			CHECK(CollectSegments(ringBuffer) == std::vector<int>(ringBuffer.begin(), ringBuffer.end()));
+			CHECK(std::is_sorted(ringBuffer.begin(), ringBuffer.end()));
+		}
+
+		WHEN("Using iterators with standard algorithms")
+		{
+			for (int i = 0; i < 6; ++i)
+				ringBuffer.push_front(i);
+
+			std::sort(ringBuffer.begin(), ringBuffer.end());
+			CHECK(CollectSegments(ringBuffer) == std::vector<int>{ 0, 1, 2, 3, 4, 5 });
+
+			auto it = std::lower_bound(ringBuffer.cbegin(), ringBuffer.cend(), 3);
+			CHECK(it - ringBuffer.cbegin() == 3);
+			CHECK(*it == 3);
+			CHECK(it[2] == 5);
+			CHECK(ringBuffer.end() - ringBuffer.begin() == 6);
+			CHECK(std::accumulate(ringBuffer.begin(), ringBuffer.end(), 0) == 15);
+
+			Nz::FixedRingBuffer<int, 8>::const_iterator constIt = ringBuffer.begin();
+			CHECK(constIt == ringBuffer.cbegin());
+			CHECK(constIt < ringBuffer.cend());
+		}
+	}
+
+	GIVEN("A ring buffer of non-trivial elements")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::FixedRingBuffer<AliveCounter, 4> ringBuffer;
+			for (int i = 0; i < 10; ++i)
+			{
+				if (ringBuffer.full())
+					ringBuffer.pop_front();
+
+				ringBuffer.emplace_back(&counter, i);
+			}
+
+			CHECK(counter.aliveCount == 4);
+			CHECK(ringBuffer.front() == 6);
+			CHECK(ringBuffer.back() == 9);
+
+			WHEN("Copying it")
+			{
+				Nz::FixedRingBuffer<AliveCounter, 4> copy(ringBuffer);
+				CHECK(counter.aliveCount == 8);
+				CHECK(std::equal(copy.begin(), copy.end(), ringBuffer.begin(), ringBuffer.end()));
+			}
+
+			WHEN("Moving it")
+			{
+				Nz::FixedRingBuffer<AliveCounter, 4> moved(std::move(ringBuffer));
+				CHECK(counter.aliveCount == 4);
+				CHECK(ringBuffer.empty());
+				CHECK(moved.front() == 6);
+				CHECK(moved.back() == 9);
+
+				ringBuffer = std::move(moved);
+				CHECK(counter.aliveCount == 4);
+				CHECK(ringBuffer.front() == 6);
+			}
+
+			WHEN("Clearing it")
+			{
+				ringBuffer.clear();
+				CHECK(ringBuffer.empty());
+				CHECK(counter.aliveCount == 0);
+			}
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("A ring buffer of move-only elements")
+	{
+		Nz::FixedRingBuffer<std::unique_ptr<int>, 2> ringBuffer;
+		ringBuffer.push_back(std::make_unique<int>(1));
+		ringBuffer.push_front(std::make_unique<int>(0));
+
+		CHECK(ringBuffer.full());
+		CHECK(*ringBuffer[0] == 0);
+		CHECK(*ringBuffer[1] == 1);
+
+		Nz::FixedRingBuffer<std::unique_ptr<int>, 2> moved(std::move(ringBuffer));
+		CHECK(*moved.front() == 0);
+		CHECK(*moved.back() == 1);
+	}
+}
+
+SCENARIO("HybridDeque", "[CORE][FIXEDRINGBUFFER]")
+{
+	GIVEN("A hybrid deque with an inline capacity of four")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::HybridDeque<AliveCounter, 4> deque;
+			CHECK(deque.capacity() == 4);
+
+			WHEN("Pushing more elements than its inline capacity at both ends")
+			{
+				for (int i = 0; i < 10; ++i)
+				{
+					deque.emplace_back(&counter, i);
+					deque.emplace_front(&counter, -i - 1);
+				}
+
+				CHECK(deque.size() == 20);
+				CHECK(deque.capacity() == 32);
+				CHECK(counter.aliveCount == 20);
+
+				std::vector<int> expectedValues(20);
+				std::iota(expectedValues.begin(), expectedValues.end(), -10);
+				CHECK(std::equal(deque.begin(), deque.end(), expectedValues.begin(), expectedValues.end()));
+
+				THEN("Pushing an element of the deque itself while it grows")
+				{
+					while (!deque.full())
+						deque.push_back(deque.front());
+
+					deque.push_back(deque.front());
+					CHECK(deque.capacity() == 64);
+					CHECK(deque.back() == -10);
+				}
+
+				THEN("Moving it steals its heap buffer")
+				{
+					const AliveCounter* front = &deque.front();
+					Nz::HybridDeque<AliveCounter, 4> moved(std::move(deque));
+					CHECK(&moved.front() == front);
+					CHECK(moved.size() == 20);
+					CHECK(deque.empty());
+					CHECK(deque.capacity() == 4);
+					CHECK(counter.aliveCount == 20);
+				}
+
+				THEN("Copying it")
+				{
+					Nz::HybridDeque<AliveCounter, 4> copy;
+					copy.push_back(AliveCounter(&counter, 42));
+					copy = deque;
+					CHECK(counter.aliveCount == 40);
+					CHECK(std::equal(copy.begin(), copy.end(), deque.begin(), deque.end()));
+				}
+			}
+
+			WHEN("Reserving capacity")
+			{
+				deque.reserve(5);
+				CHECK(deque.capacity() == 8);
+
+				for (int i = 0; i < 8; ++i)
+					deque.emplace_back(&counter, i);
+
+				CHECK(counter.moveCount == 0);
+			}
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+}
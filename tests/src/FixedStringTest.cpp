@@ -0,0 +1,143 @@
+#include <NazaraUtils/FixedString.hpp>
+#include <NazaraUtils/StringHash.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <unordered_map>
+
+using namespace std::literals;
+
+namespace
+{
+	constexpr Nz::FixedString<16> BuildIdentifier(std::string_view prefix, int index)
+	{
+		Nz::FixedString<16> identifier(prefix);
+		identifier += '_';
+		identifier += char('0' + index);
+
+		return identifier;
+	}
+}
+
+static_assert(BuildIdentifier("asset", 4) == "asset_4"sv);
+static_assert(BuildIdentifier("asset", 4).size() == 7);
+static_assert(Nz::FixedString<8>("abc").capacity() == 8);
+static_assert(sizeof(Nz::FixedString<14>) == 16);
+static_assert(std::is_trivially_copyable_v<Nz::FixedString<8>>);
+
+SCENARIO("FixedString", "[CORE][FIXEDSTRING]")
+{
+	GIVEN("A FixedString")
+	{
+		Nz::FixedString<16> str("Hello");
+		CHECK(str.size() == 5);
+		CHECK(str.capacity() == 16);
+		CHECK(str == "Hello");
+		CHECK("Hello" == str);
+		CHECK(str == "Hello"s);
+		CHECK(str != "World");
+		CHECK(std::char_traits<char>::length(str.c_str()) == 5);
+
+		WHEN("Appending characters up to its capacity")
+		{
+			str += ", World";
+			str.push_back('!');
+			str.append(3, '?');
+			CHECK(str == "Hello, World!???");
+			CHECK(str.size() == 16);
+			CHECK(str.c_str()[16] == '\0');
+		}
+
+		WHEN("Resizing it")
+		{
+			str.resize(2);
+			CHECK(str == "He");
+			CHECK(str.c_str()[2] == '\0');
+
+			str.resize(4, 'y');
+			CHECK(str == "Heyy");
+
+			str.pop_back();
+			CHECK(str == "Hey");
+			CHECK(str.back() == 'y');
+			CHECK(str.front() == 'H');
+		}
+
+		WHEN("Assigning a view of itself")
+		{
+			str = std::string_view(str).substr(1, 3);
+			CHECK(str == "ell");
+		}
+
+		WHEN("Clearing it")
+		{
+			str.clear();
+			CHECK(str.empty());
+			CHECK(str == "");
+		}
+	}
+
+	GIVEN("A HybridString")
+	{
+		Nz::HybridString<8> str = "short";
+		CHECK(str.capacity() == 8);
+
+		WHEN("Exceeding its fixed capacity")
+		{
+			str += " string that spills";
+			CHECK(str == "short string that spills");
+			CHECK(str.capacity() >= str.size());
+			CHECK(std::char_traits<char>::length(str.c_str()) == str.size());
+
+			AND_WHEN("Copying it")
+			{
+				Nz::HybridString<8> copy(str);
+				CHECK(copy == str);
+			}
+
+			AND_WHEN("Moving it")
+			{
+				Nz::HybridString<8> moved(std::move(str));
+				CHECK(moved == "short string that spills");
+			}
+
+			AND_WHEN("Shrinking it")
+			{
+				str.resize(3);
+				CHECK(str == "sho");
+			}
+		}
+
+		WHEN("Appending itself while spilling")
+		{
+			str.append(str);
+			CHECK(str == "shortshort");
+		}
+	}
+
+	GIVEN("Strings used as container keys")
+	{
+#if NAZARA_CHECK_CPP_VER(NAZARA_CPP20) && (!defined(NAZARA_PLATFORM_ANDROID) || NAZARA_CHECK_NDK_VER(26))
+		std::unordered_map<Nz::HybridString<16>, int, Nz::StringHash<>, std::equal_to<>> map;
+		map.emplace("first", 1);
+		map.emplace("second", 2);
+		map.emplace("a rather long third key", 3);
+
+		CHECK(map.find("first"sv)->second == 1);
+		CHECK(map.find(Nz::HybridString<16>("second"))->second == 2);
+		CHECK(map.find("a rather long third key")->second == 3);
+		CHECK(map.find("fourth") == map.end());
+#endif
+
+		std::unordered_map<Nz::FixedString<16>, int> fixedMap;
+		fixedMap.emplace("key", 42);
+		CHECK(fixedMap.find("key")->second == 42);
+
+		CHECK(std::hash<Nz::FixedString<16>>{}("key") == std::hash<std::string_view>{}("key"));
+		CHECK(Nz::StringHash<>{}(Nz::FixedString<16>("key")) == Nz::StringHash<>{}("key"s));
+
+		std::map<Nz::FixedString<8>, int> orderedMap;
+		orderedMap.emplace("b", 2);
+		orderedMap.emplace("a", 1);
+		CHECK(orderedMap.begin()->first == "a");
+	}
+}
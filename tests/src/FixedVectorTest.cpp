@@ -3,8 +3,55 @@
 #include <NazaraUtils/MovablePtr.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <array>
+#include <memory>
 #include <numeric>
 
+template<typename T>
+struct CountingAllocator
+{
+	using value_type = T;
+
+	CountingAllocator(std::size_t& allocationCounter) :
+	allocationCount(&allocationCounter)
+	{
+	}
+
+	template<typename U>
+	CountingAllocator(const CountingAllocator<U>& allocator) :
+	allocationCount(allocator.allocationCount)
+	{
+	}
+
+	T* allocate(std::size_t n)
+	{
+		(*allocationCount)++;
+		return std::allocator<T>{}.allocate(n);
+	}
+
+	void deallocate(T* ptr, std::size_t n)
+	{
+		std::allocator<T>{}.deallocate(ptr, n);
+	}
+
+	template<typename U>
+	bool operator==(const CountingAllocator<U>& allocator) const
+	{
+		return allocationCount == allocator.allocationCount;
+	}
+
+	template<typename U>
+	bool operator!=(const CountingAllocator<U>& allocator) const
+	{
+		return allocationCount != allocator.allocationCount;
+	}
+
+	std::size_t* allocationCount;
+};
+
+static_assert(sizeof(Nz::FixedVector<Nz::UInt8, 15>) == 16);
+static_assert(sizeof(Nz::FixedVector<Nz::UInt16, 7>) == 16);
+static_assert(sizeof(Nz::FixedVector<Nz::UInt32, 3>) == 16);
+
 template<typename T>
 struct ReferenceVector : public std::vector<T>
 {
@@ -395,6 +442,7 @@ SCENARIO("FixedVector", "[CORE][STACKVECTOR]")
 		PerformVectorTest<Nz::HybridVector<AliveCounter, 2>>("Nz::HybridVector with a capacity of 2");
 		PerformVectorTest<Nz::HybridVector<AliveCounter, 5>>("Nz::HybridVector with a capacity of 5");
 		PerformVectorTest<Nz::HybridVector<AliveCounter, 100>>("Nz::HybridVector with a capacity of 100");
+		PerformVectorTest<Nz::HybridVector<AliveCounter, 5, std::allocator<AliveCounter>, Nz::GeometricGrowthPolicy<16, 3, 2>>>("Nz::HybridVector with a capacity of 5 and a custom growth policy");
 	}
 
 	GIVEN("A FixedVector to contain objects without a default constructor")
@@ -460,4 +508,185 @@ SCENARIO("FixedVector", "[CORE][STACKVECTOR]")
 
 		CHECK(counter == 0);
 	}
+
+	GIVEN("A FixedVector of trivially relocatable objects")
+	{
+		static_assert(Nz::IsTriviallyRelocatable_v<std::unique_ptr<int>>);
+
+		auto CheckValues = [](const auto& vec, std::initializer_list<int> expectedValues)
+		{
+			REQUIRE(vec.size() == expectedValues.size());
+
+			auto it = expectedValues.begin();
+			for (const auto& ptr : vec)
+			{
+				REQUIRE(ptr);
+				CHECK(*ptr == *it++);
+			}
+		};
+
+		WHEN("Inserting and erasing elements")
+		{
+			Nz::FixedVector<std::unique_ptr<int>, 8> vec;
+			for (int i = 0; i < 5; ++i)
+				vec.push_back(std::make_unique<int>(i));
+
+			vec.insert(vec.begin(), std::make_unique<int>(-1));
+			vec.insert(vec.begin() + 3, std::make_unique<int>(42));
+			CheckValues(vec, { -1, 0, 1, 42, 2, 3, 4 });
+
+			vec.erase(vec.begin() + 3);
+			CheckValues(vec, { -1, 0, 1, 2, 3, 4 });
+
+			vec.erase(vec.begin(), vec.begin() + 2);
+			CheckValues(vec, { 1, 2, 3, 4 });
+
+			vec.erase(vec.end() - 1);
+			CheckValues(vec, { 1, 2, 3 });
+
+			AND_WHEN("Moving it")
+			{
+				Nz::FixedVector<std::unique_ptr<int>, 8> vec2(std::move(vec));
+				CheckValues(vec2, { 1, 2, 3 });
+
+				Nz::FixedVector<std::unique_ptr<int>, 8> vec3;
+				vec3.push_back(std::make_unique<int>(0));
+				vec3 = std::move(vec2);
+				CheckValues(vec3, { 1, 2, 3 });
+			}
+		}
+
+		WHEN("Spilling a HybridVector to its fallback")
+		{
+			Nz::HybridVector<std::unique_ptr<int>, 4> vec;
+			for (int i = 0; i < 4; ++i)
+				vec.push_back(std::make_unique<int>(i));
+
+			vec.insert(vec.begin() + 2, std::make_unique<int>(42));
+			CheckValues(vec, { 0, 1, 42, 2, 3 });
+			CHECK(vec.capacity() > 4);
+
+			vec.erase(vec.begin());
+			CheckValues(vec, { 1, 42, 2, 3 });
+		}
+
+		WHEN("Using trivially copyable objects")
+		{
+			Nz::HybridVector<int, 4> vec = { 1, 2, 3 };
+			vec.insert(vec.begin(), 0);
+			vec.erase(vec.begin() + 1);
+			std::array<int, 3> expectedValues = { 0, 2, 3 };
+			CHECK(std::equal(vec.begin(), vec.end(), expectedValues.begin(), expectedValues.end()));
+
+			vec.push_back(4);
+			vec.push_back(5);
+			std::array<int, 5> expectedSpilledValues = { 0, 2, 3, 4, 5 };
+			CHECK(std::equal(vec.begin(), vec.end(), expectedSpilledValues.begin(), expectedSpilledValues.end()));
+		}
+	}
+
+	GIVEN("A HybridVector with a custom growth policy and allocator")
+	{
+		using GrowthPolicy = Nz::GeometricGrowthPolicy<16, 4, 1>;
+		using Vector = Nz::HybridVector<int, 4, CountingAllocator<int>, GrowthPolicy>;
+
+		std::size_t allocationCount = 0;
+		Vector vec{ CountingAllocator<int>(allocationCount) };
+		for (int i = 0; i < 4; ++i)
+			vec.push_back(i);
+
+		CHECK(vec.capacity() == 4);
+		CHECK(allocationCount == 0);
+
+		WHEN("Spilling it to its fallback")
+		{
+			vec.push_back(4);
+			CHECK(vec.capacity() == 16);
+			CHECK(allocationCount == 1);
+
+			for (int i = 5; i < 17; ++i)
+				vec.push_back(i);
+
+			CHECK(vec.size() == 17);
+			CHECK(vec.capacity() == 64);
+			CHECK(allocationCount == 2);
+
+			AND_WHEN("Shrinking it while it doesn't fit in its fixed capacity")
+			{
+				vec.shrink_to_fit();
+				CHECK(vec.capacity() == 17);
+
+				std::array<int, 17> expectedValues;
+				std::iota(expectedValues.begin(), expectedValues.end(), 0);
+				CHECK(std::equal(vec.begin(), vec.end(), expectedValues.begin(), expectedValues.end()));
+			}
+
+			AND_WHEN("Shrinking it once it fits in its fixed capacity")
+			{
+				vec.erase(vec.begin() + 2, vec.end());
+				vec.shrink_to_fit();
+				CHECK(vec.capacity() == 4);
+				CHECK(vec.size() == 2);
+				CHECK(vec[0] == 0);
+				CHECK(vec[1] == 1);
+
+				std::size_t previousAllocationCount = allocationCount;
+				vec.push_back(2);
+				vec.push_back(3);
+				CHECK(allocationCount == previousAllocationCount);
+			}
+		}
+
+		WHEN("Shrinking it while it doesn't use its fallback")
+		{
+			vec.shrink_to_fit();
+			CHECK(vec.capacity() == 4);
+			CHECK(vec.size() == 4);
+			CHECK(allocationCount == 0);
+		}
+	}
+
+	GIVEN("A HybridVector of objects moved back inline")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::HybridVector<AliveCounter, 2> vec;
+			for (int i = 0; i < 3; ++i)
+				vec.emplace_back(&counter, i);
+
+			vec.pop_back();
+			vec.shrink_to_fit();
+			CHECK(vec.capacity() == 2);
+			CHECK(vec.size() == 2);
+			CHECK(vec[1].GetValue() == 1);
+			CHECK(counter.aliveCount == 2);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("Vectors whose capacity matches the limits of their size type")
+	{
+		Nz::FixedVector<Nz::UInt8, 255> fixedVec;
+		for (std::size_t i = 0; i < 255; ++i)
+			fixedVec.push_back(static_cast<Nz::UInt8>(i));
+
+		CHECK(fixedVec.size() == 255);
+		CHECK(fixedVec.back() == 254);
+
+		fixedVec.erase(fixedVec.begin(), fixedVec.begin() + 200);
+		CHECK(fixedVec.size() == 55);
+		CHECK(fixedVec.front() == 200);
+
+		Nz::HybridVector<Nz::UInt8, 255> hybridVec;
+		for (std::size_t i = 0; i < 255; ++i)
+			hybridVec.push_back(static_cast<Nz::UInt8>(i));
+
+		CHECK(hybridVec.size() == 255);
+		CHECK(hybridVec.capacity() == 255);
+
+		hybridVec.push_back(0);
+		CHECK(hybridVec.size() == 256);
+		CHECK(hybridVec.capacity() > 255);
+		CHECK(hybridVec[254] == 254);
+	}
 }
@@ -0,0 +1,169 @@
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/FlatMap.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace std::literals;
+
+SCENARIO("FlatMap", "[CORE][FLATMAP]")
+{
+	GIVEN("A FixedFlatMap")
+	{
+		Nz::FixedFlatMap<std::string, int, 8> map = {
+			{ "roughness", 2 },
+			{ "albedo", 1 },
+			{ "normal", 3 }
+		};
+
+		CHECK(map.size() == 3);
+		CHECK(map.keys()[0] == "albedo");
+		CHECK(map.values()[0] == 1);
+
+		WHEN("Looking up keys")
+		{
+			CHECK(map.contains("albedo"));
+			CHECK(map.contains("normal"sv));
+			CHECK_FALSE(map.contains("emissive"));
+			CHECK(map.find("emissive") == map.end());
+			CHECK(map.find("roughness")->second == 2);
+			CHECK((*map.find("normal"s)).second == 3);
+			CHECK(Nz::Retrieve(map, "albedo"sv) == 1);
+		}
+
+		WHEN("Inserting values")
+		{
+			CHECK(map.insert({ "emissive", 4 }).second);
+			CHECK_FALSE(map.insert({ "albedo", 42 }).second);
+			CHECK(map["albedo"] == 1);
+
+			auto [it, inserted] = map.insert_or_assign("albedo", 42);
+			CHECK_FALSE(inserted);
+			CHECK(it->second == 42);
+
+			CHECK(map.try_emplace("metallic", 5).second);
+			map["height"] = 6;
+
+			CHECK(map.size() == 6);
+			CHECK(std::is_sorted(map.keys().begin(), map.keys().end()));
+			CHECK(map["emissive"] == 4);
+			CHECK(map["metallic"] == 5);
+			CHECK(map["height"] == 6);
+		}
+
+		WHEN("Iterating and modifying values")
+		{
+			for (auto&& [key, value] : map)
+				value *= 10;
+
+			int expectedValues[] = { 10, 30, 20 };
+			CHECK(std::equal(map.values().begin(), map.values().end(), std::begin(expectedValues), std::end(expectedValues)));
+
+			const auto& constMap = map;
+			int sum = 0;
+			for (auto it = constMap.begin(); it != constMap.end(); ++it)
+				sum += it->second;
+
+			CHECK(sum == 60);
+			CHECK(constMap.end() - constMap.begin() == 3);
+		}
+
+		WHEN("Erasing values")
+		{
+			CHECK(map.erase("normal") == 1);
+			CHECK(map.erase("normal") == 0);
+
+			auto it = map.erase(map.begin());
+			CHECK(it->first == "roughness");
+			CHECK(map.size() == 1);
+		}
+	}
+
+	GIVEN("A HybridFlatMap of move-only values")
+	{
+		Nz::HybridFlatMap<int, std::unique_ptr<int>, 2> map;
+		for (int i = 4; i >= 0; --i)
+			map.try_emplace(i, std::make_unique<int>(i * i));
+
+		CHECK(map.size() == 5);
+		for (auto&& [key, value] : map)
+			CHECK(*value == key * key);
+
+		map.erase(2);
+		CHECK(*map[3] == 9);
+		CHECK(map[2] == nullptr);
+	}
+
+	GIVEN("A value type whose constructor can throw")
+	{
+		struct ThrowingValue
+		{
+			explicit ThrowingValue(int v) :
+			value(v)
+			{
+				if (v < 0)
+					throw std::runtime_error("negative value");
+			}
+
+			int value;
+		};
+
+		Nz::HybridFlatMap<int, ThrowingValue, 2> map;
+		map.try_emplace(1, 1);
+		map.try_emplace(3, 3);
+
+		CHECK_THROWS(map.try_emplace(2, -1));
+
+		THEN("The map is left unchanged")
+		{
+			CHECK(map.size() == 2);
+			CHECK(map.find(2) == map.end());
+			CHECK(map.find(1)->second.value == 1);
+			CHECK(map.find(3)->second.value == 3);
+
+			map.try_emplace(2, 2);
+			CHECK(map.size() == 3);
+			CHECK(map.find(2)->second.value == 2);
+		}
+	}
+
+	GIVEN("Random keys")
+	{
+		std::mt19937 randomEngine(1337);
+		std::uniform_int_distribution<unsigned int> dis(0, 200);
+
+		for (std::size_t keyCount : { 8, 16, 32, 150 })
+		{
+			Nz::HybridFlatMap<unsigned int, std::size_t, 16> map;
+			std::map<unsigned int, std::size_t> referenceMap;
+			for (std::size_t i = 0; i < keyCount; ++i)
+			{
+				unsigned int key = dis(randomEngine);
+				map.insert_or_assign(key, i);
+				referenceMap.insert_or_assign(key, i);
+			}
+
+			REQUIRE(map.size() == referenceMap.size());
+			CHECK(std::equal(map.begin(), map.end(), referenceMap.begin(), referenceMap.end(), [](const auto& lhs, const auto& rhs)
+			{
+				return lhs.first == rhs.first && lhs.second == rhs.second;
+			}));
+
+			for (unsigned int key = 0; key <= 201; ++key)
+			{
+				auto it = map.find(key);
+				auto refIt = referenceMap.find(key);
+				if (refIt == referenceMap.end())
+					CHECK(it == map.end());
+				else
+				{
+					REQUIRE(it != map.end());
+					CHECK(it->second == refIt->second);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,92 @@
+#include <NazaraUtils/FlatSet.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <set>
+#include <string>
+
+using namespace std::literals;
+
+SCENARIO("FlatSet", "[CORE][FLATSET]")
+{
+	GIVEN("A FixedFlatSet of integers")
+	{
+		Nz::FixedFlatSet<int, 8> set = { 5, 1, 3 };
+		CHECK(set.size() == 3);
+		CHECK(std::is_sorted(set.begin(), set.end()));
+
+		WHEN("Inserting keys")
+		{
+			CHECK(set.insert(2).second);
+			CHECK_FALSE(set.insert(3).second);
+			CHECK(*set.insert(4).first == 4);
+
+			int expectedKeys[] = { 1, 2, 3, 4, 5 };
+			CHECK(std::equal(set.begin(), set.end(), std::begin(expectedKeys), std::end(expectedKeys)));
+		}
+
+		WHEN("Looking up keys")
+		{
+			CHECK(set.contains(1));
+			CHECK_FALSE(set.contains(2));
+			CHECK(set.find(4) == set.end());
+			CHECK(*set.find(5) == 5);
+			CHECK(*set.lower_bound(2) == 3);
+			CHECK(set.lower_bound(6) == set.end());
+		}
+
+		WHEN("Erasing keys")
+		{
+			CHECK(set.erase(3) == 1);
+			CHECK(set.erase(3) == 0);
+			CHECK(set.size() == 2);
+
+			set.erase(set.begin());
+			CHECK(set.size() == 1);
+			CHECK(*set.begin() == 5);
+		}
+	}
+
+	GIVEN("A HybridFlatSet of strings")
+	{
+		Nz::HybridFlatSet<std::string, 4> set;
+		for (const char* key : { "delta", "alpha", "echo", "charlie", "bravo" })
+			set.insert(key);
+
+		CHECK(set.size() == 5);
+		CHECK(std::is_sorted(set.begin(), set.end()));
+		CHECK(set.contains("charlie"sv));
+		CHECK(set.contains("alpha"));
+		CHECK_FALSE(set.contains("foxtrot"sv));
+	}
+
+	GIVEN("Random keys")
+	{
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<int> dis(-100, 100);
+
+		for (std::size_t keyCount : { 4, 16, 17, 100 })
+		{
+			Nz::HybridFlatSet<int, 16> set;
+			Nz::HybridFlatSet<int, 16, std::greater<>> reversedSet;
+			std::set<int> referenceSet;
+			for (std::size_t i = 0; i < keyCount; ++i)
+			{
+				int key = dis(randomEngine);
+				CHECK(set.insert(key).second == referenceSet.insert(key).second);
+				reversedSet.insert(key);
+			}
+
+			CHECK(std::equal(set.begin(), set.end(), referenceSet.begin(), referenceSet.end()));
+			CHECK(std::equal(reversedSet.begin(), reversedSet.end(), referenceSet.rbegin(), referenceSet.rend()));
+
+			for (int key = -101; key <= 101; ++key)
+			{
+				CHECK(set.contains(key) == (referenceSet.count(key) != 0));
+				CHECK(reversedSet.contains(key) == (referenceSet.count(key) != 0));
+
+				auto it = referenceSet.lower_bound(key);
+				CHECK(set.lower_bound(key) - set.begin() == std::distance(referenceSet.begin(), it));
+			}
+		}
+	}
+}
@@ -0,0 +1,97 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/FrameAllocator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+SCENARIO("FrameAllocator", "[CORE][FRAMEALLOCATOR]")
+{
+	GIVEN("A frame allocator with three frames in flight")
+	{
+		Nz::FrameAllocator<3> allocator(1024);
+		CHECK(allocator.GetBlockSize() == 1024);
+		CHECK(allocator.GetFrameIndex() == 0);
+		CHECK(allocator.GetThreadCount() == 0);
+		CHECK(allocator.GetCapacity() == 0);
+
+		WHEN("We allocate objects over several frames")
+		{
+			AliveCounterStruct counter;
+
+			std::vector<int*> values;
+			for (int frame = 0; frame < 3; ++frame)
+			{
+				int* value = allocator.New<int>(frame);
+				values.push_back(value);
+
+				allocator.New<AliveCounter>(&counter, frame);
+				allocator.NextFrame();
+			}
+
+			CHECK(allocator.GetFrameIndex() == 3);
+			CHECK(allocator.GetThreadCount() == 1);
+			CHECK(allocator.GetCapacity() == 3 * 1024);
+
+			THEN("Memory of a frame is reclaimed when its arena comes back")
+			{
+				// Frame #3 reclaimed frame #0 memory
+				CHECK(counter.aliveCount == 2);
+				CHECK(*values[1] == 1);
+				CHECK(*values[2] == 2);
+
+				CHECK(allocator.New<int>(3) == values[0]);
+
+				allocator.NextFrame();
+				CHECK(counter.aliveCount == 1);
+
+				allocator.NextFrame();
+				CHECK(counter.aliveCount == 0);
+			}
+		}
+
+		WHEN("Multiple threads allocate")
+		{
+			constexpr std::size_t ThreadCount = 4;
+			constexpr std::size_t AllocationCount = 1000;
+
+			std::vector<std::vector<std::uint32_t*>> allocations(ThreadCount);
+
+			std::vector<std::thread> threads;
+			for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+			{
+				threads.emplace_back([&, threadIndex]
+				{
+					for (std::size_t i = 0; i < AllocationCount; ++i)
+					{
+						std::uint32_t* ptr = static_cast<std::uint32_t*>(allocator.Allocate(sizeof(std::uint32_t) * 4, alignof(std::uint32_t)));
+						for (std::size_t j = 0; j < 4; ++j)
+							ptr[j] = std::uint32_t(threadIndex * AllocationCount + i);
+
+						allocations[threadIndex].push_back(ptr);
+					}
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			THEN("Each thread got its own arenas and allocations don't overlap")
+			{
+				CHECK(allocator.GetThreadCount() == ThreadCount);
+
+				bool intact = true;
+				for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+				{
+					for (std::size_t i = 0; i < AllocationCount; ++i)
+					{
+						for (std::size_t j = 0; j < 4; ++j)
+							intact &= (allocations[threadIndex][i][j] == std::uint32_t(threadIndex * AllocationCount + i));
+					}
+				}
+
+				CHECK(intact);
+			}
+		}
+	}
+}
@@ -2,6 +2,9 @@
 #include <NazaraUtils/TypeName.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
 
 template<typename T, std::size_t N, typename H>
 void TestHash(const char (&str)[N], H expectedHash)
@@ -17,6 +20,33 @@ void TestHash(const char (&str)[N], H expectedHash)
 	CHECK(hash(reinterpret_cast<const Nz::UInt8*>(str), size) == expectedHash);
 }
 
+// Bitwise CRC-32 implementation, used as a reference
+Nz::UInt32 ReferenceCRC32(const Nz::UInt8* data, std::size_t size)
+{
+	Nz::UInt32 crc = 0xFFFFFFFFu;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		crc ^= data[i];
+		for (unsigned int bit = 0; bit < 8; ++bit)
+			crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0u);
+	}
+
+	return ~crc;
+}
+
+Nz::UInt32 ReferenceCRC32C(const Nz::UInt8* data, std::size_t size)
+{
+	Nz::UInt32 crc = 0xFFFFFFFFu;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		crc ^= data[i];
+		for (unsigned int bit = 0; bit < 8; ++bit)
+			crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78u : 0u);
+	}
+
+	return ~crc;
+}
+
 TEST_CASE("Hash", "[Hash]")
 {
 	static_assert(Nz::CRC32("Nazara Engine") == 0x8a2f5235u);
@@ -27,6 +57,12 @@ TEST_CASE("Hash", "[Hash]")
 	TestHash<Nz::CRC32Hash>("t.tv/SirLynixVanFriejtes", 0xcc2a0914u);
 	TestHash<Nz::CRC32Hash>("The quick brown fox jumps over the lazy dog", 0x414fa339u);
 
+	static_assert(Nz::CRC32C("123456789") == 0xe3069283u);
+	static_assert(Nz::CRC32C("The quick brown fox jumps over the lazy dog") == 0x22620404u);
+
+	TestHash<Nz::CRC32CHash>("123456789", 0xe3069283u);
+	TestHash<Nz::CRC32CHash>("The quick brown fox jumps over the lazy dog", 0x22620404u);
+
 	static_assert(Nz::FNV1a32("Nazara Engine") == 0x5ba735a6u);
 	static_assert(Nz::FNV1a32("t.tv/SirLynixVanFriejtes") == 0x3ef9d843u);
 	static_assert(Nz::FNV1a32("The quick brown fox jumps over the lazy dog") == 0x048fff90u);
@@ -42,4 +78,65 @@ TEST_CASE("Hash", "[Hash]")
 	TestHash<Nz::FNV1a64Hash>("Nazara Engine", 0xa00fb3557d90f6e6u);
 	TestHash<Nz::FNV1a64Hash>("t.tv/SirLynixVanFriejtes", 0x4d2631a6429ff643u);
 	TestHash<Nz::FNV1a64Hash>("The quick brown fox jumps over the lazy dog", 0xf3f9b7f5e7e47110u);
+
+	SECTION("CRC32 of buffers of any size and alignment")
+	{
+		// Constant evaluation always uses the bytewise table, this checks it against the runtime paths below
+		static_assert(Nz::CRC32("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.") == 0x474B756Fu);
+
+		std::mt19937 randomEngine(42);
+		std::vector<Nz::UInt8> data(4096 + 16);
+		for (Nz::UInt8& byte : data)
+			byte = static_cast<Nz::UInt8>(randomEngine());
+
+		for (std::size_t offset = 0; offset < 16; ++offset)
+		{
+			for (std::size_t size : { 0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 200, 1000, 4096 })
+			{
+				INFO("offset = " << offset << ", size = " << size);
+				CHECK(Nz::CRC32(data.data() + offset, size) == ReferenceCRC32(data.data() + offset, size));
+			}
+		}
+
+		std::string_view str(reinterpret_cast<const char*>(data.data()), data.size());
+		CHECK(Nz::CRC32(str) == ReferenceCRC32(data.data(), data.size()));
+	}
+
+	SECTION("CRC32C of buffers of any size and alignment")
+	{
+		std::mt19937 randomEngine(42);
+		std::vector<Nz::UInt8> data(3 * 8192 * 2 + 16);
+		for (Nz::UInt8& byte : data)
+			byte = static_cast<Nz::UInt8>(randomEngine());
+
+		for (std::size_t offset = 0; offset < 16; ++offset)
+		{
+			// Sizes around the interleaved blocks of 3 * 256 and 3 * 8192 bytes
+			for (std::size_t size : { 0, 1, 7, 8, 9, 100, 767, 768, 769, 1000, 24575, 24576, 24577, 3 * 8192 * 2 })
+			{
+				INFO("offset = " << offset << ", size = " << size);
+				CHECK(Nz::CRC32C(data.data() + offset, size) == ReferenceCRC32C(data.data() + offset, size));
+			}
+		}
+	}
+
+	SECTION("CRC32 and CRC32C slicing fallback")
+	{
+		// Runtime CRC32 functions only use the slicing loop on short tails when hardware acceleration is available, call it directly
+		std::mt19937 randomEngine(42);
+		std::vector<Nz::UInt8> data(1000 + 16);
+		for (Nz::UInt8& byte : data)
+			byte = static_cast<Nz::UInt8>(randomEngine());
+
+		for (std::size_t offset = 0; offset < 16; ++offset)
+		{
+			for (std::size_t size : { 0, 15, 16, 17, 64, 65, 127, 128, 200, 1000 })
+			{
+				INFO("offset = " << offset << ", size = " << size);
+				const Nz::UInt8* ptr = data.data() + offset;
+				CHECK(~Nz::Detail::UpdateCRC32Slicing(0xFFFFFFFFu, ptr, size, Nz::Detail::GetCRC32SlicingTables<0xEDB88320>()) == ReferenceCRC32(ptr, size));
+				CHECK(~Nz::Detail::UpdateCRC32Slicing(0xFFFFFFFFu, ptr, size, Nz::Detail::GetCRC32SlicingTables<0x82F63B78>()) == ReferenceCRC32C(ptr, size));
+			}
+		}
+	}
 }
@@ -0,0 +1,118 @@
+#include <NazaraUtils/InplaceFunction.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+#include <string>
+
+namespace
+{
+	int Add(int a, int b)
+	{
+		return a + b;
+	}
+
+	int Twice(int value)
+	{
+		return value * 2;
+	}
+}
+
+SCENARIO("InplaceFunction", "[InplaceFunction]")
+{
+	GIVEN("An empty function")
+	{
+		Nz::InplaceFunction<int(int, int)> func;
+		CHECK_FALSE(func);
+
+		WHEN("Assigning a function pointer")
+		{
+			func = Add;
+			CHECK(func);
+			CHECK(func(1, 2) == 3);
+
+			func = nullptr;
+			CHECK_FALSE(func);
+		}
+
+		WHEN("Assigning a stateful lambda")
+		{
+			int callCount = 0;
+			func = [&callCount, offset = 10](int a, int b) mutable
+			{
+				callCount++;
+				return a + b + offset++;
+			};
+
+			CHECK(func(1, 2) == 13);
+			CHECK(func(1, 2) == 14);
+			CHECK(callCount == 2);
+
+			THEN("Moving it keeps its state")
+			{
+				Nz::InplaceFunction<int(int, int)> moved(std::move(func));
+				CHECK_FALSE(func);
+				CHECK(moved(0, 0) == 12);
+				CHECK(callCount == 3);
+			}
+		}
+	}
+
+	GIVEN("A function capturing move-only state")
+	{
+		auto value = std::make_shared<int>(42);
+		std::weak_ptr<int> weakValue = value;
+
+		Nz::InplaceFunction<int()> func([ptr = std::make_unique<int>(7), value = std::move(value)] { return *ptr + *value; });
+		CHECK(func() == 49);
+
+		Nz::InplaceFunction<int()> other;
+		other = std::move(func);
+		CHECK(other() == 49);
+		CHECK_FALSE(weakValue.expired());
+
+		other.Reset();
+		CHECK_FALSE(other);
+		CHECK(weakValue.expired());
+	}
+
+	GIVEN("A function with a bigger capacity")
+	{
+		std::array<int, 16> values = { 1, 2, 3 };
+		Nz::InplaceFunction<int(std::string), sizeof(values)> func([values](std::string str)
+		{
+			return values[0] + values[1] + values[2] + int(str.size());
+		});
+
+		CHECK(func("abcd") == 10);
+	}
+
+	GIVEN("A void function wrapping a callable returning a value")
+	{
+		int callCount = 0;
+		Nz::InplaceFunction<void(int)> func([&](int value) { callCount += value; return callCount; });
+		func(2);
+		func(3);
+		CHECK(callCount == 5);
+
+		Nz::InplaceFunction<void(int)> pointerFunc(&Twice);
+		pointerFunc(1);
+		CHECK(pointerFunc);
+	}
+
+	GIVEN("Empty callables")
+	{
+		Nz::InplaceFunction<void()> nullPointer = static_cast<void(*)()>(nullptr);
+		CHECK_FALSE(nullPointer);
+
+		int (*nullTwice)(int) = nullptr;
+		Nz::InplaceFunction<int(int)> nullFunc(nullTwice);
+		CHECK_FALSE(nullFunc);
+
+		Nz::InplaceFunction<int(int), 8 * sizeof(void*)> emptyFunction{ Nz::InplaceFunction<int(int)>{} };
+		CHECK_FALSE(emptyFunction);
+
+		Nz::InplaceFunction<int(int), 8 * sizeof(void*)> wrappedFunction{ Nz::InplaceFunction<int(int)>(&Twice) };
+		REQUIRE(wrappedFunction);
+		CHECK(wrappedFunction(21) == 42);
+	}
+}
@@ -0,0 +1,214 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/LinearArena.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct OrderTracker
+	{
+		OrderTracker(std::vector<int>& destroyed, int value) :
+		destroyedValues(destroyed),
+		id(value)
+		{
+		}
+
+		~OrderTracker()
+		{
+			destroyedValues.push_back(id);
+		}
+
+		std::vector<int>& destroyedValues;
+		int id;
+	};
+
+	struct ThrowingConstructor
+	{
+		ThrowingConstructor()
+		{
+			if (constructionsBeforeThrow-- == 0)
+				throw std::runtime_error("construction failed");
+
+			aliveCount++;
+		}
+
+		~ThrowingConstructor()
+		{
+			aliveCount--;
+		}
+
+		static inline int aliveCount = 0;
+		static inline int constructionsBeforeThrow = 0;
+	};
+}
+
+SCENARIO("LinearArena", "[CORE][LINEARARENA]")
+{
+	GIVEN("A linear arena with 256B blocks")
+	{
+		Nz::LinearArena arena(256);
+		CHECK(arena.GetBlockCount() == 1);
+		CHECK(arena.GetBlockSize() == 256);
+		CHECK(arena.GetCapacity() == 256);
+
+		WHEN("We allocate memory with various alignments")
+		{
+			for (std::size_t alignment : { 1, 2, 4, 8, 16, 32, 64 })
+			{
+				void* ptr = arena.Allocate(3, alignment);
+				CHECK(ptr);
+				CHECK(Nz::PointerToInteger<std::uintptr_t>(ptr) % alignment == 0);
+			}
+
+			CHECK(arena.GetBlockCount() == 1);
+		}
+
+		WHEN("We allocate more than a block")
+		{
+			std::vector<std::byte*> allocations;
+			for (std::size_t i = 0; i < 10; ++i)
+			{
+				std::byte* ptr = static_cast<std::byte*>(arena.Allocate(100, 1));
+				std::fill(ptr, ptr + 100, std::byte(i));
+				allocations.push_back(ptr);
+			}
+
+			CHECK(arena.GetBlockCount() == 5);
+
+			for (std::size_t i = 0; i < allocations.size(); ++i)
+			{
+				for (std::size_t j = 0; j < 100; ++j)
+					CHECK(allocations[i][j] == std::byte(i));
+			}
+
+			AND_WHEN("We reset the arena")
+			{
+				arena.Reset();
+				CHECK(arena.GetBlockCount() == 5);
+
+				THEN("Blocks are reused")
+				{
+					CHECK(arena.Allocate(100, 1) == allocations[0]);
+					CHECK(arena.Allocate(100, 1) == allocations[1]);
+					CHECK(arena.Allocate(100, 1) == allocations[2]);
+					CHECK(arena.GetBlockCount() == 5);
+				}
+			}
+
+			AND_WHEN("We clear the arena")
+			{
+				arena.Clear();
+				CHECK(arena.GetBlockCount() == 0);
+				CHECK(arena.GetCapacity() == 0);
+
+				arena.Allocate(100, 1);
+				CHECK(arena.GetBlockCount() == 1);
+			}
+		}
+
+		WHEN("We allocate more than the block size at once")
+		{
+			void* ptr = arena.Allocate(1000, 64);
+			CHECK(Nz::PointerToInteger<std::uintptr_t>(ptr) % 64 == 0);
+			CHECK(arena.GetBlockCount() == 2);
+			CHECK(arena.GetCapacity() >= 256 + 1000);
+		}
+
+		WHEN("We construct objects")
+		{
+			AliveCounterStruct counter;
+
+			int* value = arena.New<int>(42);
+			CHECK(*value == 42);
+
+			AliveCounter* aliveCounter = arena.New<AliveCounter>(&counter, 1);
+			CHECK(aliveCounter->GetValue() == 1);
+
+			std::string* str = arena.New<std::string>("The quick brown fox jumps over the lazy dog, and keeps going to avoid SSO");
+			CHECK(*str == "The quick brown fox jumps over the lazy dog, and keeps going to avoid SSO");
+
+			AliveCounter* counters = arena.NewArray<AliveCounter>(3);
+			for (std::size_t i = 0; i < 3; ++i)
+				counters[i] = AliveCounter(&counter, int(i));
+
+			CHECK(counter.aliveCount == 4);
+
+			AND_WHEN("We reset the arena")
+			{
+				arena.Reset();
+				CHECK(counter.aliveCount == 0);
+			}
+
+			AND_WHEN("The arena is destroyed")
+			{
+				{
+					Nz::LinearArena movedArena(std::move(arena));
+					CHECK(counter.aliveCount == 4);
+
+					// Resetting the moved-from arena must not destroy anything
+					arena.Reset();
+					CHECK(counter.aliveCount == 4);
+				}
+				CHECK(counter.aliveCount == 0);
+			}
+		}
+
+		WHEN("An array constructor throws")
+		{
+			ThrowingConstructor::aliveCount = 0;
+			ThrowingConstructor::constructionsBeforeThrow = 3;
+			CHECK_THROWS_AS(arena.NewArray<ThrowingConstructor>(5), std::runtime_error);
+			CHECK(ThrowingConstructor::aliveCount == 0);
+
+			ThrowingConstructor::constructionsBeforeThrow = 5;
+			arena.NewArray<ThrowingConstructor>(5);
+			CHECK(ThrowingConstructor::aliveCount == 5);
+
+			// Only the successfully constructed array is destroyed
+			arena.Reset();
+			CHECK(ThrowingConstructor::aliveCount == 0);
+		}
+
+		WHEN("An array size overflows")
+		{
+			CHECK_THROWS_AS(arena.NewArray<Nz::UInt64>(std::numeric_limits<std::size_t>::max() / 4), std::bad_array_new_length);
+		}
+
+		WHEN("We use markers")
+		{
+			std::vector<int> destroyed;
+
+			arena.New<OrderTracker>(destroyed, 1);
+			void* firstAlloc = arena.Allocate(16);
+			Nz::LinearArena::Marker marker = arena.GetMarker();
+
+			void* secondAlloc = arena.Allocate(16);
+			arena.New<OrderTracker>(destroyed, 2);
+			arena.New<OrderTracker>(destroyed, 3);
+			{
+				Nz::LinearArena::RewindScope scope(arena);
+
+				arena.New<OrderTracker>(destroyed, 4);
+				arena.Allocate(1000);
+				arena.New<OrderTracker>(destroyed, 5);
+			}
+			CHECK(destroyed == std::vector<int>{ 5, 4 });
+
+			arena.Rewind(marker);
+			CHECK(destroyed == std::vector<int>{ 5, 4, 3, 2 });
+
+			CHECK(arena.Allocate(16) == secondAlloc);
+			CHECK(arena.Allocate(16) != firstAlloc);
+
+			arena.Reset();
+			CHECK(destroyed == std::vector<int>{ 5, 4, 3, 2, 1 });
+		}
+	}
+}
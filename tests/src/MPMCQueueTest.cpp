@@ -0,0 +1,120 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/MPMCQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+SCENARIO("MPMCQueue", "[CORE][MPMCQUEUE]")
+{
+	GIVEN("A queue of four integers")
+	{
+		Nz::MPMCQueue<int, 4> queue;
+		CHECK(queue.GetCapacity() == 4);
+
+		int value;
+		CHECK_FALSE(queue.TryPop(value));
+
+		WHEN("Filling it over several laps")
+		{
+			for (int lap = 0; lap < 3; ++lap)
+			{
+				for (int i = 0; i < 4; ++i)
+					CHECK(queue.TryPush(lap * 4 + i));
+
+				CHECK_FALSE(queue.TryPush(-1));
+
+				for (int i = 0; i < 4; ++i)
+				{
+					CHECK(queue.TryPop(value));
+					CHECK(value == lap * 4 + i);
+				}
+
+				CHECK_FALSE(queue.TryPop(value));
+			}
+		}
+
+		WHEN("Pushing and popping in batches")
+		{
+			std::array<int, 6> values = { 0, 1, 2, 3, 4, 5 };
+			CHECK(queue.TryPushN(values.begin(), values.size()) == 4);
+			CHECK(queue.TryPushN(values.begin(), values.size()) == 0);
+
+			std::vector<int> popped;
+			CHECK(queue.TryPopN(std::back_inserter(popped), 3) == 3);
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 2);
+			CHECK(queue.TryPopN(std::back_inserter(popped), 10) == 3);
+			CHECK(popped == std::vector<int>{ 0, 1, 2, 3, 4, 5 });
+			CHECK(queue.TryPopN(std::back_inserter(popped), 10) == 0);
+		}
+	}
+
+	GIVEN("A queue of non-trivial elements")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::MPMCQueue<AliveCounter, 8> queue;
+			for (int i = 0; i < 5; ++i)
+				CHECK(queue.TryEmplace(&counter, i));
+
+			AliveCounter value;
+			CHECK(queue.TryPop(value));
+			CHECK(value == 0);
+			CHECK(counter.aliveCount == 5);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("Multiple producer and consumer threads")
+	{
+		constexpr std::size_t threadCount = 4;
+		constexpr std::size_t elementPerProducer = 20'000;
+
+		Nz::MPMCQueue<std::size_t, 128> queue;
+		std::vector<std::atomic<std::size_t>> receivedCount(threadCount * elementPerProducer);
+		std::atomic<std::size_t> poppedCount(0);
+
+		std::vector<std::thread> threads;
+		for (std::size_t producerIndex = 0; producerIndex < threadCount; ++producerIndex)
+		{
+			threads.emplace_back([&, producerIndex]
+			{
+				std::size_t firstValue = producerIndex * elementPerProducer;
+				std::size_t nextValue = 0;
+				while (nextValue < elementPerProducer)
+				{
+					std::array<std::size_t, 4> batch;
+					for (std::size_t i = 0; i < batch.size(); ++i)
+						batch[i] = firstValue + nextValue + i;
+
+					nextValue += queue.TryPushN(batch.begin(), std::min(batch.size(), elementPerProducer - nextValue));
+				}
+			});
+		}
+
+		for (std::size_t consumerIndex = 0; consumerIndex < threadCount; ++consumerIndex)
+		{
+			threads.emplace_back([&]
+			{
+				std::array<std::size_t, 8> batch;
+				while (poppedCount.load() < threadCount * elementPerProducer)
+				{
+					std::size_t count = queue.TryPopN(batch.begin(), batch.size());
+					for (std::size_t i = 0; i < count; ++i)
+						receivedCount[batch[i]]++;
+
+					poppedCount += count;
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		CHECK(poppedCount == threadCount * elementPerProducer);
+		CHECK(std::all_of(receivedCount.begin(), receivedCount.end(), [](const std::atomic<std::size_t>& count) { return count == 1; }));
+	}
+}
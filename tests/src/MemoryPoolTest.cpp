@@ -1,5 +1,10 @@
+#include "AliveCounter.hpp"
 #include <NazaraUtils/MemoryPool.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -129,6 +134,59 @@ SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 					CHECK(sumX == 11);
 					CHECK(sumY == 13);
 				}
+				AND_THEN("We iterate on the memory pool using ForEach")
+				{
+					std::size_t count = 0;
+					int sumX = 0;
+					int sumY = 0;
+					memoryPool.ForEach([&](T& vec)
+					{
+						count++;
+						sumX += vec.x;
+						sumY += vec.y;
+					});
+
+					CHECK(count == 3);
+					CHECK(sumX == 11);
+					CHECK(sumY == 13);
+
+					std::vector<std::size_t> indices;
+					std::as_const(memoryPool).ForEach([&](std::size_t index, const T& vec)
+					{
+						CHECK(memoryPool.RetrieveFromIndex(index) == &vec);
+						indices.push_back(index);
+					});
+
+					CHECK(indices == std::vector<std::size_t>{ index1, index2, index3 });
+				}
+				AND_THEN("We iterate on the memory pool using ParallelForEach")
+				{
+					auto executor = [](std::size_t jobCount, Nz::FunctionRef<void(std::size_t)> job)
+					{
+						std::atomic_size_t nextJob = 0;
+						auto worker = [&]
+						{
+							std::size_t jobIndex;
+							while ((jobIndex = nextJob++) < jobCount)
+								job(jobIndex);
+						};
+
+						std::thread thread(worker);
+						worker();
+						thread.join();
+					};
+
+					std::atomic_int sumX = 0;
+					std::atomic_int sumY = 0;
+					memoryPool.ParallelForEach(executor, [&](T& vec)
+					{
+						sumX += vec.x;
+						sumY += vec.y;
+					});
+
+					CHECK(sumX == 11);
+					CHECK(sumY == 13);
+				}
 				AND_THEN("We iterate on the memory pool (const)")
 				{
 					std::size_t count = 0;
@@ -142,6 +200,19 @@ SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 				}
 			}
 
+			WHEN("We free entries while iterating")
+			{
+				memoryPool.ForEach([&](std::size_t index, T& vec)
+				{
+					if (vec.x != 3)
+						memoryPool.Free(index);
+				});
+
+				CHECK(allocationCount == 1);
+				CHECK(memoryPool.GetAllocatedEntryCount() == 1);
+				CHECK(memoryPool.RetrieveFromIndex(index2)->y == 4);
+			}
+
 			memoryPool.Reset();
 			CHECK(allocationCount == 0);
 			CHECK(memoryPool.GetAllocatedEntryCount() == 0);
@@ -165,3 +236,177 @@ SCENARIO("MemoryPool", "[CORE][MEMORYPOOL]")
 		}
 	}
 }
+
+SCENARIO("MemoryPool compaction", "[CORE][MEMORYPOOL]")
+{
+	GIVEN("A sparsely occupied MemoryPool")
+	{
+		constexpr std::size_t BlockSize = 100;
+		constexpr std::size_t EntryCount = 1000;
+
+		AliveCounterStruct counter;
+		Nz::MemoryPool<AliveCounter> memoryPool(BlockSize);
+
+		std::vector<std::size_t> handles(EntryCount);
+		for (std::size_t i = 0; i < EntryCount; ++i)
+			memoryPool.Allocate(handles[i], &counter, int(i));
+
+		CHECK(memoryPool.GetBlockCount() == 10);
+
+		// Free every entry except one in seven
+		std::size_t liveCount = 0;
+		for (std::size_t i = 0; i < EntryCount; ++i)
+		{
+			if (i % 7 != 0)
+			{
+				memoryPool.Free(handles[i]);
+				handles[i] = memoryPool.InvalidIndex;
+			}
+			else
+				liveCount++;
+		}
+
+		CHECK(counter.aliveCount == liveCount);
+		CHECK(memoryPool.GetAllocatedEntryCount() == liveCount);
+		CHECK(memoryPool.GetBlockCount() == 10);
+
+		WHEN("We compact it")
+		{
+			std::size_t callbackCount = 0;
+			std::size_t relocatedCount = memoryPool.Compact([&](std::size_t oldIndex, std::size_t newIndex)
+			{
+				CHECK(newIndex < oldIndex);
+				callbackCount++;
+
+				auto it = std::find(handles.begin(), handles.end(), oldIndex);
+				REQUIRE(it != handles.end());
+				*it = newIndex;
+			});
+
+			THEN("Entries are packed in the first blocks")
+			{
+				CHECK(relocatedCount > 0);
+				CHECK(relocatedCount == callbackCount);
+				CHECK(counter.moveCount == relocatedCount);
+				CHECK(counter.aliveCount == liveCount);
+				CHECK(memoryPool.GetAllocatedEntryCount() == liveCount);
+				CHECK(memoryPool.GetBlockCount() == (liveCount + BlockSize - 1) / BlockSize);
+				CHECK(memoryPool.GetFreeEntryCount() == memoryPool.GetBlockCount() * BlockSize - liveCount);
+
+				std::size_t expectedIndex = 0;
+				memoryPool.ForEach([&](std::size_t index, AliveCounter&)
+				{
+					CHECK(index == expectedIndex++);
+				});
+				CHECK(expectedIndex == liveCount);
+
+				for (std::size_t i = 0; i < EntryCount; ++i)
+				{
+					if (handles[i] != memoryPool.InvalidIndex)
+						CHECK(memoryPool.RetrieveFromIndex(handles[i])->GetValue() == int(i));
+				}
+			}
+
+			AND_WHEN("We compact it again")
+			{
+				CHECK(memoryPool.Compact() == 0);
+				CHECK(memoryPool.GetAllocatedEntryCount() == liveCount);
+			}
+		}
+
+		WHEN("We free everything and compact it")
+		{
+			memoryPool.Reset();
+			CHECK(counter.aliveCount == 0);
+			CHECK(memoryPool.Compact() == 0);
+			CHECK(memoryPool.GetBlockCount() == 0);
+
+			std::size_t index;
+			memoryPool.Allocate(index, &counter, 42);
+			CHECK(index == 0);
+			CHECK(memoryPool.GetBlockCount() == 1);
+		}
+	}
+}
+
+SCENARIO("MemoryPool statistics", "[CORE][MEMORYPOOL]")
+{
+	GIVEN("A MemoryPool with statistics enabled")
+	{
+		static_assert(!Nz::MemoryPool<int>::HasStatistics);
+		static_assert(sizeof(Nz::MemoryPool<int>) == sizeof(std::size_t) + sizeof(std::vector<int>), "disabled statistics must not take any space");
+		static_assert(Nz::MemoryPool<int, alignof(int), true>::HasStatistics);
+
+		Nz::MemoryPool<int, alignof(int), true> memoryPool(10);
+
+		Nz::MemoryPoolStatistics statistics = memoryPool.GetStatistics();
+		CHECK(statistics.allocatedEntryCount == 0);
+		CHECK(statistics.blockCount == 1);
+		CHECK(statistics.blockSize == 10);
+		CHECK(statistics.occupancyHistogram[0] == 1);
+		CHECK(statistics.fragmentation == 1.f);
+		CHECK(statistics.averageSearchLength == 0.f);
+
+		WHEN("We allocate and free entries")
+		{
+			std::vector<std::size_t> indices(25);
+			for (std::size_t i = 0; i < indices.size(); ++i)
+				memoryPool.Allocate(indices[i], int(i));
+
+			for (std::size_t i = 0; i < 10; ++i)
+				memoryPool.Free(indices[i]);
+
+			statistics = memoryPool.GetStatistics();
+			CHECK(statistics.allocatedEntryCount == 15);
+			CHECK(statistics.peakAllocatedEntryCount == 25);
+			CHECK(statistics.blockCount == 3);
+			CHECK(statistics.occupancyHistogram[0] == 1); //< first block is empty
+			CHECK(statistics.occupancyHistogram[5] == 1); //< last block is half full
+			CHECK(statistics.occupancyHistogram[9] == 1); //< second block is full
+			CHECK(statistics.fragmentation == 1.f - 2.f / 3.f);
+			CHECK(statistics.intervalAllocationCount == 25);
+			CHECK(statistics.intervalFreeCount == 10);
+			CHECK(statistics.totalAllocationCount == 25);
+			CHECK(statistics.totalFreeCount == 10);
+			CHECK(statistics.averageSearchLength == (10.f * 1.f + 10.f * 2.f + 5.f * 3.f) / 25.f);
+
+			AND_WHEN("We start a new interval")
+			{
+				memoryPool.ResetStatisticsInterval();
+
+				std::size_t index;
+				memoryPool.Allocate(index, 42);
+
+				statistics = memoryPool.GetStatistics();
+				CHECK(statistics.allocatedEntryCount == 16);
+				CHECK(statistics.peakAllocatedEntryCount == 25);
+				CHECK(statistics.intervalAllocationCount == 1);
+				CHECK(statistics.intervalFreeCount == 0);
+				CHECK(statistics.totalAllocationCount == 26);
+				CHECK(statistics.totalFreeCount == 10);
+				CHECK(statistics.averageSearchLength == 1.f);
+			}
+
+			AND_WHEN("We reset the pool")
+			{
+				memoryPool.Reset();
+
+				statistics = memoryPool.GetStatistics();
+				CHECK(statistics.allocatedEntryCount == 0);
+				CHECK(statistics.peakAllocatedEntryCount == 25);
+				CHECK(statistics.intervalFreeCount == 25);
+				CHECK(statistics.totalAllocationCount == 25);
+				CHECK(statistics.totalFreeCount == 25);
+			}
+
+			AND_WHEN("We compact the pool")
+			{
+				memoryPool.Compact();
+
+				statistics = memoryPool.GetStatistics();
+				CHECK(statistics.blockCount == 2);
+				CHECK(statistics.fragmentation == 0.f);
+			}
+		}
+	}
+}
@@ -0,0 +1,142 @@
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryResource.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	class DefaultResourceGuard
+	{
+		public:
+			DefaultResourceGuard(std::pmr::memory_resource* resource) :
+			m_previousResource(std::pmr::set_default_resource(resource))
+			{
+			}
+
+			~DefaultResourceGuard()
+			{
+				std::pmr::set_default_resource(m_previousResource);
+			}
+
+		private:
+			std::pmr::memory_resource* m_previousResource;
+	};
+}
+
+SCENARIO("Memory resources", "[CORE][MEMORYRESOURCE]")
+{
+	// Make sure nothing goes through the default resource
+	DefaultResourceGuard defaultResourceGuard(std::pmr::null_memory_resource());
+
+	GIVEN("An arena memory resource")
+	{
+		Nz::LinearArena arena(1024);
+		Nz::ArenaMemoryResource resource(arena);
+		CHECK(&resource.GetArena() == &arena);
+		CHECK(resource == resource);
+
+		WHEN("We use it with standard containers")
+		{
+			std::pmr::vector<int> vec(&resource);
+			for (int i = 0; i < 1000; ++i)
+				vec.push_back(i);
+
+			std::pmr::string str("The quick brown fox jumps over the lazy dog, and keeps going to avoid SSO", &resource);
+			str += str;
+
+			CHECK(vec.size() == 1000);
+			CHECK(vec[999] == 999);
+			CHECK(str.size() == 146);
+			CHECK(arena.GetBlockCount() > 1);
+		}
+
+		WHEN("We use it as the fallback allocator of a PmrHybridVector")
+		{
+			Nz::PmrHybridVector<int, 4> vec(&resource);
+			for (int i = 0; i < 4; ++i)
+				vec.push_back(i);
+
+			Nz::LinearArena::Marker marker = arena.GetMarker();
+			void* ptr = arena.Allocate(1);
+			arena.Rewind(marker);
+
+			vec.push_back(4);
+			vec.push_back(5);
+			CHECK(vec.size() == 6);
+			CHECK(vec.capacity() > 4);
+			for (int i = 0; i < 6; ++i)
+				CHECK(vec[i] == i);
+
+			// Fallback storage was allocated from the arena
+			CHECK(arena.Allocate(1) != ptr);
+		}
+	}
+
+	GIVEN("A pool memory resource")
+	{
+		Nz::PoolMemoryResource resource(16 * 1024, std::pmr::null_memory_resource());
+		CHECK(resource.GetSlabAllocator().GetSlabSize() == 16 * 1024);
+		CHECK(resource.GetAllocatedEntryCount() == 0);
+		CHECK(resource.GetUpstreamResource() == std::pmr::null_memory_resource());
+
+		WHEN("We allocate from it")
+		{
+			std::vector<std::pair<void*, std::size_t>> allocations;
+			for (std::size_t size : { 1, 8, 9, 16, 24, 100, 512, 1024 })
+			{
+				for (std::size_t i = 0; i < 20; ++i)
+				{
+					void* ptr = resource.allocate(size, std::min(Nz::RoundToPow2(size), alignof(std::max_align_t)));
+					std::memset(ptr, 0xAB, size);
+					allocations.emplace_back(ptr, size);
+				}
+			}
+
+			CHECK(resource.GetAllocatedEntryCount() == allocations.size());
+
+			THEN("Allocations are aligned")
+			{
+				for (auto&& [ptr, size] : allocations)
+					CHECK(reinterpret_cast<std::uintptr_t>(ptr) % std::min(Nz::RoundToPow2(size), alignof(std::max_align_t)) == 0);
+			}
+
+			AND_WHEN("We free them")
+			{
+				for (auto&& [ptr, size] : allocations)
+					resource.deallocate(ptr, size, std::min(Nz::RoundToPow2(size), alignof(std::max_align_t)));
+
+				CHECK(resource.GetAllocatedEntryCount() == 0);
+			}
+
+			AND_WHEN("We release the resource")
+			{
+				resource.Release();
+				CHECK(resource.GetAllocatedEntryCount() == 0);
+				CHECK(resource.GetSlabAllocator().GetSlabCount() == 0);
+			}
+		}
+
+		WHEN("We allocate more than the biggest size class")
+		{
+			CHECK_THROWS_AS(resource.allocate(Nz::SlabAllocator::MaxSizeClass + 1), std::bad_alloc);
+			CHECK_THROWS_AS(resource.allocate(16, 2 * alignof(std::max_align_t)), std::bad_alloc);
+		}
+
+		WHEN("We use it with standard containers")
+		{
+			std::pmr::unordered_map<int, std::pmr::string> map(&resource);
+			for (int i = 0; i < 100; ++i)
+				map.emplace(i, "The quick brown fox jumps over the lazy dog #" + std::to_string(i));
+
+			CHECK(map.size() == 100);
+			CHECK(map.at(42) == "The quick brown fox jumps over the lazy dog #42");
+			CHECK(resource.GetAllocatedEntryCount() > 100);
+
+			map.clear();
+			map.rehash(0);
+		}
+	}
+}
@@ -0,0 +1,160 @@
+#include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/ParallelAlgorithm.hpp>
+#include <NazaraUtils/SparsePtr.hpp>
+#include <NazaraUtils/StackArray.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+SCENARIO("Parallel algorithms", "[CORE][PARALLELALGORITHM]")
+{
+	Nz::TaskScheduler scheduler(4);
+
+	GIVEN("A vector of one million integers")
+	{
+		constexpr std::size_t elementCount = 1'000'000;
+
+		std::vector<Nz::UInt32> values(elementCount);
+		std::iota(values.begin(), values.end(), 0);
+
+		WHEN("Using ParallelFor on indices")
+		{
+			std::vector<std::atomic<unsigned int>> visitCount(elementCount);
+			Nz::ParallelFor(scheduler, elementCount, 1000, [&](std::size_t index)
+			{
+				visitCount[index]++;
+			});
+
+			CHECK(std::all_of(visitCount.begin(), visitCount.end(), [](const std::atomic<unsigned int>& count) { return count == 1; }));
+		}
+
+		WHEN("Using ParallelFor on elements with an automatic grain size")
+		{
+			Nz::ParallelFor(scheduler, values, 0, [](Nz::UInt32& value)
+			{
+				value *= 2;
+			});
+
+			CHECK(values[0] == 0);
+			CHECK(values[12345] == 24690);
+			CHECK(values.back() == (elementCount - 1) * 2);
+		}
+
+		WHEN("Using ParallelFor with element indices")
+		{
+			Nz::ParallelFor(scheduler, values.data(), values.size(), 4096, [](std::size_t index, Nz::UInt32& value)
+			{
+				value = Nz::UInt32(index * 3);
+			});
+
+			CHECK(values[1000] == 3000);
+		}
+
+		WHEN("Using ParallelReduce")
+		{
+			Nz::UInt64 sum = Nz::ParallelReduce(scheduler, values, 0, Nz::UInt64(0));
+			CHECK(sum == Nz::UInt64(elementCount) * (elementCount - 1) / 2);
+
+			Nz::UInt32 maxValue = Nz::ParallelReduce(scheduler, values.data(), values.size(), 10'000, Nz::UInt32(0), [](Nz::UInt32 a, Nz::UInt32 b) { return std::max(a, b); });
+			CHECK(maxValue == elementCount - 1);
+		}
+
+		WHEN("Using ParallelReduce with an operation taking an accumulated value and an element")
+		{
+			std::vector<double> twos(100'000, 2.0);
+			double sumOfSquares = Nz::ParallelReduce(scheduler, twos, 0, 0.0, 0.0, [](double acc, double x) { return acc + x * x; }, std::plus<>());
+			CHECK(sumOfSquares == 400'000.0);
+
+			std::size_t evenCount = Nz::ParallelReduce(scheduler, values.data(), values.size(), 1000, std::size_t(1), std::size_t(0), [](std::size_t count, Nz::UInt32 value)
+			{
+				return (value % 2 == 0) ? count + 1 : count;
+			}, std::plus<>());
+			CHECK(evenCount == elementCount / 2 + 1);
+
+			auto mul = [](double a, double b) { return a * b; };
+			CHECK(Nz::ParallelReduce(scheduler, twos.data(), 20, 4, 1.0, 1.0, mul, mul) == 1'048'576.0);
+			CHECK(Nz::ParallelReduce(scheduler, twos.data(), 20, 4, 3.0, 1.0, mul, mul) == 3'145'728.0);
+		}
+
+		WHEN("Using ParallelTransform")
+		{
+			std::vector<Nz::UInt64> squares(elementCount);
+			Nz::ParallelTransform(scheduler, values, squares.begin(), 0, [](Nz::UInt32 value) { return Nz::UInt64(value) * value; });
+
+			CHECK(squares[1000] == 1'000'000);
+			CHECK(squares.back() == Nz::UInt64(elementCount - 1) * (elementCount - 1));
+		}
+
+		WHEN("Using ParallelSort")
+		{
+			std::mt19937 randomEngine(42);
+			std::shuffle(values.begin(), values.end(), randomEngine);
+
+			Nz::ParallelSort(scheduler, values);
+			CHECK(std::is_sorted(values.begin(), values.end()));
+			CHECK(values[123456] == 123456);
+
+			Nz::ParallelSort(scheduler, values.data(), values.size(), std::greater<>());
+			CHECK(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+		}
+	}
+
+	GIVEN("Small containers")
+	{
+		WHEN("Using a FixedVector")
+		{
+			Nz::FixedVector<int, 16> vec = { 5, 3, 1, 4, 2 };
+			Nz::ParallelSort(scheduler, vec);
+			CHECK(std::is_sorted(vec.begin(), vec.end()));
+			CHECK(Nz::ParallelReduce(scheduler, vec, 1, 0) == 15);
+		}
+
+		WHEN("Using a StackArray")
+		{
+			Nz::StackArray<int> array = NazaraStackArray(int, 100);
+			Nz::ParallelFor(scheduler, array, 10, [](std::size_t index, int& value) { value = int(index); });
+			CHECK(Nz::ParallelReduce(scheduler, array, 7, 0) == 4950);
+		}
+
+		WHEN("Using an empty range")
+		{
+			std::vector<std::string> strings;
+			CHECK(Nz::ParallelReduce(scheduler, strings, 0, std::string("init")) == "init");
+			Nz::ParallelFor(scheduler, strings, 0, [](std::string&) { FAIL("should not be called"); });
+			Nz::ParallelSort(scheduler, strings);
+		}
+
+		WHEN("Reducing with a non-commutative operation")
+		{
+			std::vector<std::string> strings = { "a", "b", "c", "d", "e", "f", "g" };
+			CHECK(Nz::ParallelReduce(scheduler, strings, 2, std::string(">")) == ">abcdefg");
+			CHECK(Nz::ParallelReduce(scheduler, strings, 3, std::string(">"), std::string(), [](std::string acc, const std::string& str) { return acc + str + str; }, std::plus<>()) == ">aabbccddeeffgg");
+		}
+	}
+
+	GIVEN("A SparsePtr over interleaved data")
+	{
+		struct Vertex
+		{
+			float position;
+			int id;
+		};
+
+		std::vector<Vertex> vertices(10'000);
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+			vertices[i] = { float(vertices.size() - i), int(i) };
+
+		Nz::SparsePtr<float> positions(&vertices[0].position, sizeof(Vertex));
+
+		double sum = Nz::ParallelReduce(scheduler, positions, vertices.size(), 0, 0.0);
+		CHECK(sum == double(vertices.size() * (vertices.size() + 1) / 2));
+
+		Nz::ParallelSort(scheduler, positions, vertices.size());
+		CHECK(std::is_sorted(positions, positions + vertices.size()));
+		CHECK(vertices[0].id == 0); //< only positions are sorted
+	}
+}
@@ -0,0 +1,133 @@
+#include <NazaraUtils/QueuedSignal.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+SCENARIO("QueuedSignal", "[CORE][QUEUEDSIGNAL]")
+{
+	GIVEN("A queued signal with a slot")
+	{
+		Nz::QueuedSignal<int, const std::string&> signal;
+
+		std::vector<std::pair<int, std::string>> receivedEvents;
+		Nz::QueuedSignal<int, const std::string&>::ConnectionGuard guard = signal.Connect([&](int id, const std::string& name)
+		{
+			receivedEvents.emplace_back(id, name);
+		});
+
+		WHEN("We emit events")
+		{
+			std::string name = "first";
+			signal(1, name);
+			name = "second";
+			signal(2, name);
+
+			THEN("Nothing is delivered until the signal is flushed")
+			{
+				CHECK(receivedEvents.empty());
+				CHECK(signal.GetPendingEventCount() == 2);
+
+				CHECK(signal.Flush() == 2);
+				REQUIRE(receivedEvents.size() == 2);
+				CHECK(receivedEvents[0] == std::make_pair(1, std::string("first")));
+				CHECK(receivedEvents[1] == std::make_pair(2, std::string("second")));
+
+				CHECK(signal.GetPendingEventCount() == 0);
+				CHECK(signal.Flush() == 0);
+				CHECK(receivedEvents.size() == 2);
+			}
+		}
+
+		WHEN("We emit coalesced events")
+		{
+			signal.EmitCoalesced(10, 1, "a");
+			signal(2, "b");
+			signal.EmitCoalesced(20, 3, "c");
+			signal.EmitCoalesced(10, 4, "d");
+			signal.EmitCoalesced(10, 5, "e");
+
+			THEN("Only the last event of each key is delivered, at the position of the first one")
+			{
+				CHECK(signal.Flush() == 3);
+				REQUIRE(receivedEvents.size() == 3);
+				CHECK(receivedEvents[0] == std::make_pair(5, std::string("e")));
+				CHECK(receivedEvents[1] == std::make_pair(2, std::string("b")));
+				CHECK(receivedEvents[2] == std::make_pair(3, std::string("c")));
+
+				signal.EmitCoalesced(10, 6, "f");
+				CHECK(signal.Flush() == 1);
+				CHECK(receivedEvents.back() == std::make_pair(6, std::string("f")));
+			}
+		}
+
+		WHEN("A slot emits while flushing")
+		{
+			signal.Connect([&](int id, const std::string& name)
+			{
+				if (id < 3)
+					signal(id + 1, name);
+			});
+
+			signal(0, "chain");
+
+			THEN("New events are delivered by the next flush")
+			{
+				CHECK(signal.Flush() == 1);
+				CHECK(signal.Flush() == 1);
+				CHECK(signal.Flush() == 1);
+				CHECK(signal.Flush() == 1);
+				CHECK(signal.Flush() == 0);
+				CHECK(receivedEvents.size() == 4);
+			}
+		}
+
+		WHEN("We discard events")
+		{
+			signal(1, "discarded");
+			signal.DiscardEvents();
+
+			CHECK(signal.Flush() == 0);
+			CHECK(receivedEvents.empty());
+		}
+	}
+
+	GIVEN("Multiple threads emitting events")
+	{
+		constexpr std::size_t ThreadCount = 4;
+		constexpr std::size_t EventCount = 10'000;
+
+		Nz::QueuedSignal<std::size_t> signal(1024);
+
+		std::size_t eventCount = 0;
+		std::size_t sum = 0;
+		signal.Connect([&](std::size_t value)
+		{
+			eventCount++;
+			sum += value;
+		});
+
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < ThreadCount; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (std::size_t j = 0; j < EventCount; ++j)
+					signal(j);
+			});
+		}
+
+		// Flush on this thread while others are emitting
+		for (std::size_t i = 0; i < 100; ++i)
+			signal.Flush();
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		signal.Flush();
+
+		CHECK(eventCount == ThreadCount * EventCount);
+		CHECK(sum == ThreadCount * EventCount * (EventCount - 1) / 2);
+	}
+}
@@ -0,0 +1,126 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/SPSCQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+SCENARIO("SPSCQueue", "[CORE][SPSCQUEUE]")
+{
+	GIVEN("A queue of four integers")
+	{
+		Nz::SPSCQueue<int, 4> queue;
+		CHECK(queue.GetCapacity() == 4);
+
+		int value;
+		CHECK_FALSE(queue.TryPop(value));
+
+		WHEN("Filling it")
+		{
+			for (int i = 0; i < 4; ++i)
+				CHECK(queue.TryPush(i));
+
+			CHECK_FALSE(queue.TryPush(4));
+
+			THEN("Elements are popped in FIFO order")
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					CHECK(queue.TryPop(value));
+					CHECK(value == i);
+				}
+
+				CHECK_FALSE(queue.TryPop(value));
+			}
+		}
+
+		WHEN("Pushing and popping in batches")
+		{
+			std::array<int, 6> values = { 0, 1, 2, 3, 4, 5 };
+			CHECK(queue.TryPushN(values.begin(), values.size()) == 4);
+			CHECK(queue.TryPushN(values.begin(), values.size()) == 0);
+
+			std::vector<int> popped;
+			CHECK(queue.TryPopN(std::back_inserter(popped), 3) == 3);
+			CHECK(queue.TryPushN(values.begin() + 4, 2) == 2);
+			CHECK(queue.TryPopN(std::back_inserter(popped), 10) == 3);
+			CHECK(popped == std::vector<int>{ 0, 1, 2, 3, 4, 5 });
+			CHECK(queue.TryPopN(std::back_inserter(popped), 10) == 0);
+		}
+	}
+
+	GIVEN("A queue of non-trivial elements")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::SPSCQueue<AliveCounter, 8> queue;
+			for (int i = 0; i < 5; ++i)
+				CHECK(queue.TryEmplace(&counter, i));
+
+			AliveCounter value;
+			CHECK(queue.TryPop(value));
+			CHECK(value == 0);
+			CHECK(counter.aliveCount == 5);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+
+	GIVEN("A queue of move-only elements")
+	{
+		Nz::SPSCQueue<std::unique_ptr<int>, 4> queue;
+
+		std::array<std::unique_ptr<int>, 2> values = { std::make_unique<int>(1), std::make_unique<int>(2) };
+		CHECK(queue.TryPushN(std::make_move_iterator(values.begin()), values.size()) == 2);
+		CHECK(queue.TryPush(std::make_unique<int>(3)));
+
+		std::unique_ptr<int> value;
+		CHECK(queue.TryPop(value));
+		CHECK(*value == 1);
+	}
+
+	GIVEN("A producer and a consumer thread")
+	{
+		constexpr std::size_t elementCount = 100'000;
+
+		Nz::SPSCQueue<std::size_t, 64> queue;
+		std::thread producer([&]
+		{
+			std::array<std::size_t, 8> batch;
+			std::size_t nextValue = 0;
+			while (nextValue < elementCount)
+			{
+				if (nextValue % 3 == 0)
+				{
+					if (queue.TryPush(nextValue))
+						nextValue++;
+				}
+				else
+				{
+					std::size_t batchSize = std::min(batch.size(), elementCount - nextValue);
+					for (std::size_t i = 0; i < batchSize; ++i)
+						batch[i] = nextValue + i;
+
+					nextValue += queue.TryPushN(batch.begin(), batchSize);
+				}
+			}
+		});
+
+		bool ordered = true;
+		std::size_t expectedValue = 0;
+		std::array<std::size_t, 16> batch;
+		while (expectedValue < elementCount)
+		{
+			std::size_t count = queue.TryPopN(batch.begin(), batch.size());
+			for (std::size_t i = 0; i < count; ++i)
+				ordered = ordered && (batch[i] == expectedValue++);
+		}
+
+		producer.join();
+
+		CHECK(ordered);
+		CHECK(expectedValue == elementCount);
+	}
+}
@@ -1,5 +1,8 @@
 #include <NazaraUtils/Signal.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+#include <vector>
 
 struct Incrementer
 {
@@ -14,6 +17,11 @@ void increment(int* inc)
 	*inc += 1;
 }
 
+int incrementAndGet(int* inc)
+{
+	return ++*inc;
+}
+
 SCENARIO("Signal", "[CORE][SIGNAL]")
 {
 	GIVEN("A signal")
@@ -44,5 +52,178 @@ SCENARIO("Signal", "[CORE][SIGNAL]")
 				REQUIRE(inc == 2);
 			}
 		}
+
+		WHEN("We disconnect slots while emitting")
+		{
+			int callCount = 0;
+			Nz::Signal<int*>::Connection selfConnection;
+			Nz::Signal<int*>::Connection otherConnection;
+
+			selfConnection = signal.Connect([&](int*)
+			{
+				callCount++;
+				selfConnection.Disconnect();
+				otherConnection.Disconnect();
+			});
+			otherConnection = signal.Connect([&](int*) { callCount++; });
+			signal.Connect([&](int*) { callCount++; });
+
+			int inc = 0;
+			signal(&inc);
+
+			THEN("Disconnected slots are not called anymore")
+			{
+				// The order of slots is not specified, the second slot may have been called before the first one
+				CHECK((callCount == 2 || callCount == 3));
+				CHECK(!selfConnection.IsConnected());
+				CHECK(!otherConnection.IsConnected());
+
+				callCount = 0;
+				signal(&inc);
+				CHECK(callCount == 1);
+			}
+		}
+
+		WHEN("We connect slots while emitting")
+		{
+			int callCount = 0;
+			std::vector<Nz::Signal<int*>::Connection> connections;
+			signal.Connect([&](int*)
+			{
+				callCount++;
+				if (connections.size() < 100)
+					connections.push_back(signal.Connect([&](int*) { callCount++; }));
+			});
+
+			int inc = 0;
+			signal(&inc);
+
+			THEN("New slots are called starting with the next emission")
+			{
+				CHECK(callCount == 1);
+				CHECK(connections.size() == 1);
+
+				callCount = 0;
+				signal(&inc);
+				CHECK(callCount == 2);
+				CHECK(connections.size() == 2);
+			}
+		}
+
+		WHEN("Destroying a disconnected slot disconnects other slots")
+		{
+			int callCount = 0;
+			auto guard = std::make_shared<Nz::Signal<int*>::ConnectionGuard>();
+
+			// This slot owns a guard of the last slot, which is disconnected when the callback is destroyed (once the emission is over)
+			Nz::Signal<int*>::Connection selfConnection;
+			selfConnection = signal.Connect([&, guard](int*) { selfConnection.Disconnect(); });
+
+			std::vector<Nz::Signal<int*>::Connection> connections;
+			for (int i = 0; i < 4; ++i)
+				connections.push_back(signal.Connect([&](int*) { callCount++; }));
+
+			*guard = connections.back();
+			guard.reset();
+
+			int inc = 0;
+			signal(&inc);
+			CHECK(callCount == 4);
+			CHECK(!selfConnection.IsConnected());
+			CHECK(!connections.back().IsConnected());
+
+			callCount = 0;
+			signal(&inc);
+			CHECK(callCount == 3);
+
+			signal.Connect([&, otherGuard = std::make_shared<Nz::Signal<int*>::ConnectionGuard>(connections[1])](int*) {});
+			signal.Clear();
+			CHECK(!connections[1].IsConnected());
+		}
+
+		WHEN("The signal is cleared while emitting")
+		{
+			int callCount = 0;
+			auto connection = signal.Connect([&](int*) { callCount++; signal.Clear(); });
+			signal.Connect([&](int*) { callCount++; signal.Clear(); });
+
+			int inc = 0;
+			signal(&inc);
+			CHECK(callCount == 1);
+			CHECK(!connection.IsConnected());
+
+			signal(&inc);
+			CHECK(callCount == 1);
+		}
+	}
+
+	GIVEN("Connections and connection guards")
+	{
+		int inc = 0;
+		Nz::Signal<int*>::Connection connection;
+		{
+			Nz::Signal<int*> signal;
+			connection = signal.Connect(increment);
+			{
+				Nz::Signal<int*>::ConnectionGuard guard = signal.Connect(increment);
+				CHECK(guard.IsConnected());
+
+				signal(&inc);
+				CHECK(inc == 2);
+			}
+
+			signal(&inc);
+			CHECK(inc == 3);
+
+			Nz::Signal<int*> movedSignal(std::move(signal));
+			CHECK(connection.IsConnected());
+
+			movedSignal(&inc);
+			CHECK(inc == 4);
+
+			Nz::Signal<int*> copiedSignal(movedSignal);
+			copiedSignal(&inc);
+			CHECK(inc == 4);
+		}
+
+		CHECK(!connection.IsConnected());
+		connection.Disconnect();
+	}
+
+	GIVEN("Callbacks of different sizes")
+	{
+		Nz::Signal<int, int&> signal;
+
+		std::array<int, 32> bigCapture = {};
+		bigCapture[31] = 10;
+		signal.Connect([bigCapture](int value, int& result) { result += value * bigCapture[31]; });
+
+		auto sharedValue = std::make_shared<int>(5);
+		signal.Connect([sharedValue](int value, int& result) { result += value * *sharedValue; });
+
+		Nz::Signal<int, int&>::Callback callback = [](int value, int& result) { result += value; };
+		signal.Connect(std::move(callback));
+
+		int result = 0;
+		signal(2, result);
+		CHECK(result == 32);
+
+		signal.Clear();
+		CHECK(sharedValue.use_count() == 1);
+
+		signal(2, result);
+		CHECK(result == 32);
+	}
+
+	GIVEN("Callbacks returning a value")
+	{
+		Nz::Signal<int*> signal;
+		signal.Connect(&incrementAndGet);
+		signal.Connect(incrementAndGet);
+		signal.Connect([](int* inc) { return *inc += 10; });
+
+		int inc = 0;
+		signal(&inc);
+		CHECK(inc == 12);
 	}
 }
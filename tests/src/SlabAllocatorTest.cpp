@@ -0,0 +1,157 @@
+#include <NazaraUtils/SlabAllocator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+SCENARIO("SlabAllocator", "[CORE][SLABALLOCATOR]")
+{
+	GIVEN("Size classes")
+	{
+		static_assert(Nz::SlabAllocator::GetSizeClassIndex(1) == 0);
+		static_assert(Nz::SlabAllocator::GetSizeClassIndex(8) == 0);
+		static_assert(Nz::SlabAllocator::GetSizeClassIndex(9) == 1);
+		static_assert(Nz::SlabAllocator::GetSizeClassIndex(Nz::SlabAllocator::MaxSizeClass) == Nz::SlabAllocator::SizeClassCount - 1);
+		static_assert(Nz::SlabAllocator::GetSizeClassSize(Nz::SlabAllocator::SizeClassCount - 1) == Nz::SlabAllocator::MaxSizeClass);
+
+		std::vector<std::size_t> expectedSizes = { 8, 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512 };
+		for (std::size_t i = 0; i < expectedSizes.size(); ++i)
+			CHECK(Nz::SlabAllocator::GetSizeClassSize(i) == expectedSizes[i]);
+
+		for (std::size_t size = 1; size <= Nz::SlabAllocator::MaxSizeClass; ++size)
+		{
+			std::size_t sizeClassIndex = Nz::SlabAllocator::GetSizeClassIndex(size);
+			CHECK(Nz::SlabAllocator::GetSizeClassSize(sizeClassIndex) >= size);
+			if (sizeClassIndex > 0)
+				CHECK(Nz::SlabAllocator::GetSizeClassSize(sizeClassIndex - 1) < size);
+		}
+	}
+
+	GIVEN("A slab allocator with 16KiB slabs")
+	{
+		Nz::SlabAllocator allocator(16 * 1024);
+		CHECK(allocator.GetAllocatedEntryCount() == 0);
+		CHECK(allocator.GetSlabCount() == 0);
+		CHECK(allocator.GetSlabSize() == 16 * 1024);
+
+		WHEN("We allocate objects of various sizes")
+		{
+			struct Allocation
+			{
+				std::uint8_t* ptr;
+				std::size_t size;
+			};
+
+			std::mt19937 randomEngine(42);
+			std::uniform_int_distribution<std::size_t> sizeDis(1, 512);
+
+			std::vector<Allocation> allocations;
+			for (std::size_t i = 0; i < 2000; ++i)
+			{
+				std::size_t size = sizeDis(randomEngine);
+				std::uint8_t* ptr = static_cast<std::uint8_t*>(allocator.Allocate(size));
+				std::memset(ptr, int(i % 256), size);
+				allocations.push_back({ ptr, size });
+			}
+
+			CHECK(allocator.GetAllocatedEntryCount() == allocations.size());
+
+			THEN("Allocations are aligned and don't overlap")
+			{
+				for (std::size_t i = 0; i < allocations.size(); ++i)
+				{
+					const Allocation& allocation = allocations[i];
+					CHECK(reinterpret_cast<std::uintptr_t>(allocation.ptr) % std::min<std::size_t>(Nz::SlabAllocator::GetSizeClassSize(Nz::SlabAllocator::GetSizeClassIndex(allocation.size)), alignof(std::max_align_t)) == 0);
+
+					bool intact = true;
+					for (std::size_t j = 0; j < allocation.size; ++j)
+						intact &= (allocation.ptr[j] == std::uint8_t(i % 256));
+
+					CHECK(intact);
+				}
+			}
+
+			AND_WHEN("We free half of them and allocate again")
+			{
+				std::size_t slabCount = allocator.GetSlabCount();
+				for (std::size_t i = 0; i < allocations.size(); i += 2)
+					allocator.Free(allocations[i].ptr, allocations[i].size);
+
+				CHECK(allocator.GetAllocatedEntryCount() == allocations.size() / 2);
+
+				for (std::size_t i = 0; i < allocations.size(); i += 2)
+					allocations[i].ptr = static_cast<std::uint8_t*>(allocator.Allocate(allocations[i].size));
+
+				THEN("Free entries are reused")
+				{
+					CHECK(allocator.GetAllocatedEntryCount() == allocations.size());
+					CHECK(allocator.GetSlabCount() == slabCount);
+				}
+			}
+
+			AND_WHEN("We free everything")
+			{
+				for (const Allocation& allocation : allocations)
+					allocator.Free(allocation.ptr, allocation.size);
+
+				CHECK(allocator.GetAllocatedEntryCount() == 0);
+				CHECK(allocator.GetSlabCount() > 0);
+
+				std::size_t slabCount = allocator.GetSlabCount();
+				CHECK(allocator.ReleaseEmptySlabs() == slabCount);
+				CHECK(allocator.GetSlabCount() == 0);
+			}
+
+			AND_WHEN("We clear the allocator")
+			{
+				allocator.Clear();
+				CHECK(allocator.GetAllocatedEntryCount() == 0);
+				CHECK(allocator.GetSlabCount() == 0);
+			}
+		}
+
+		WHEN("We allocate more than the biggest size class")
+		{
+			void* ptr = allocator.Allocate(Nz::SlabAllocator::MaxSizeClass + 1);
+			CHECK(ptr);
+			CHECK(allocator.GetAllocatedEntryCount() == 0);
+			CHECK(allocator.GetSlabCount() == 0);
+
+			allocator.Free(ptr, Nz::SlabAllocator::MaxSizeClass + 1);
+		}
+
+		WHEN("We fill a slab")
+		{
+			std::vector<void*> allocations;
+			while (allocator.GetSlabCount() < 2)
+				allocations.push_back(allocator.Allocate(64));
+
+			std::size_t entryCountPerSlab = allocations.size() - 1;
+			CHECK(entryCountPerSlab < 16 * 1024 / 64); //< slab header takes some room
+			CHECK(entryCountPerSlab > 16 * 1024 / 64 - 4);
+
+			AND_WHEN("We free one entry of the first slab")
+			{
+				allocator.Free(allocations[10], 64);
+
+				THEN("It's reused by the next allocation")
+				{
+					CHECK(allocator.Allocate(64) == allocations[10]);
+				}
+			}
+
+			AND_WHEN("We move the allocator")
+			{
+				Nz::SlabAllocator movedAllocator(std::move(allocator));
+				CHECK(movedAllocator.GetSlabCount() == 2);
+				CHECK(movedAllocator.GetAllocatedEntryCount() == allocations.size());
+
+				for (void* ptr : allocations)
+					movedAllocator.Free(ptr, 64);
+
+				CHECK(movedAllocator.GetAllocatedEntryCount() == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,143 @@
+#include "AliveCounter.hpp"
+#include <NazaraUtils/SoAMemoryPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct Position
+	{
+		float x;
+		float y;
+	};
+
+	struct Velocity
+	{
+		float x;
+		float y;
+	};
+}
+
+SCENARIO("SoAMemoryPool", "[CORE][MEMORYPOOL]")
+{
+	GIVEN("A SoAMemoryPool storing a position, a velocity and a name")
+	{
+		using Pool = Nz::SoAMemoryPool<Nz::TypeList<Position, Velocity, std::string>>;
+
+		Pool pool(4);
+		CHECK(pool.GetAllocatedEntryCount() == 0);
+		CHECK(pool.GetBlockCount() == 1);
+		CHECK(pool.GetBlockSize() == 4);
+		CHECK(pool.GetFreeEntryCount() == 4);
+		CHECK(Pool::FieldCount == 3);
+
+		WHEN("We allocate entries")
+		{
+			std::vector<std::size_t> indices(6);
+			for (std::size_t i = 0; i < indices.size(); ++i)
+			{
+				auto [position, velocity, name] = pool.Allocate(indices[i], Position{ float(i), 0.f }, Velocity{ 1.f, 2.f }, "entity #" + std::to_string(i));
+				CHECK(position->x == float(i));
+				CHECK(velocity->y == 2.f);
+				CHECK(*name == "entity #" + std::to_string(i));
+			}
+
+			CHECK(pool.GetAllocatedEntryCount() == 6);
+			CHECK(pool.GetBlockCount() == 2);
+			CHECK(pool.GetFreeEntryCount() == 2);
+
+			THEN("Fields can be retrieved by type or by index")
+			{
+				CHECK(pool.Get<Position>(indices[3]).x == 3.f);
+				CHECK(pool.Get<0>(indices[3]).x == 3.f);
+				CHECK(pool.Get<std::string>(indices[5]) == "entity #5");
+				CHECK(&pool.Get<2>(indices[5]) == &pool.Get<std::string>(indices[5]));
+				CHECK(&pool.Get<Position>(indices[1]) == &pool.Get<Position>(indices[0]) + 1);
+			}
+
+			AND_WHEN("We free some of them and update the remaining ones")
+			{
+				pool.Free(indices[1]);
+				pool.Free(indices[4]);
+				CHECK(pool.GetAllocatedEntryCount() == 4);
+				CHECK_FALSE(pool.IsAllocated(indices[1]));
+				CHECK(pool.IsAllocated(indices[2]));
+
+				std::size_t spanCount = 0;
+				std::size_t entryCount = 0;
+				pool.ForEachSpan<Position, Velocity>([&](std::size_t firstIndex, std::size_t count, Position* positions, Velocity* velocities)
+				{
+					spanCount++;
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						CHECK(pool.IsAllocated(firstIndex + i));
+						positions[i].x += velocities[i].x;
+						positions[i].y += velocities[i].y;
+						entryCount++;
+					}
+				});
+
+				CHECK(spanCount == 3); //< [0], [2, 3] and [5]
+				CHECK(entryCount == 4);
+
+				THEN("Every remaining entry has been updated")
+				{
+					std::size_t count = 0;
+					pool.ForEach([&](std::size_t index, Position& position, Velocity&, std::string& name)
+					{
+						CHECK(name == "entity #" + std::to_string(index));
+						CHECK(position.x == float(index) + 1.f);
+						CHECK(position.y == 2.f);
+						count++;
+					});
+					CHECK(count == 4);
+
+					std::size_t constSpanCount = 0;
+					std::as_const(pool).ForEachSpan([&](std::size_t /*firstIndex*/, std::size_t /*count*/, const Position*, const Velocity*, const std::string*)
+					{
+						constSpanCount++;
+					});
+					CHECK(constSpanCount == 3);
+				}
+
+				AND_WHEN("We allocate again")
+				{
+					std::size_t index;
+					pool.Allocate(index);
+					CHECK(index == indices[1]);
+					CHECK(pool.Get<std::string>(index).empty());
+					CHECK(pool.Get<Velocity>(index).x == 0.f);
+				}
+			}
+
+			pool.Reset();
+			CHECK(pool.GetAllocatedEntryCount() == 0);
+			CHECK(pool.GetBlockCount() == 2);
+			CHECK(pool.GetFreeEntryCount() == 8);
+
+			pool.Clear();
+			CHECK(pool.GetBlockCount() == 0);
+			CHECK(pool.GetFreeEntryCount() == 0);
+		}
+	}
+
+	GIVEN("A SoAMemoryPool with non-trivial fields")
+	{
+		AliveCounterStruct counter;
+		{
+			Nz::SoAMemoryPool<Nz::TypeList<AliveCounter, int, AliveCounter>> pool(16);
+
+			std::size_t index1, index2;
+			pool.Allocate(index1, AliveCounter(&counter, 1), 2, AliveCounter(&counter, 3));
+			pool.Allocate(index2, AliveCounter(&counter, 4), 5, AliveCounter(&counter, 6));
+			CHECK(counter.aliveCount == 4);
+			CHECK(pool.Get<0>(index1).GetValue() == 1);
+			CHECK(pool.Get<2>(index2).GetValue() == 6);
+
+			pool.Free(index1);
+			CHECK(counter.aliveCount == 2);
+		}
+		CHECK(counter.aliveCount == 0);
+	}
+}
@@ -0,0 +1,222 @@
+#include <NazaraUtils/TLSFAllocator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+SCENARIO("TLSFAllocator", "[CORE][TLSFALLOCATOR]")
+{
+	constexpr std::size_t RegionSize = 1024 * 1024;
+	std::unique_ptr<std::byte[]> region(new std::byte[RegionSize]);
+
+	GIVEN("A TLSF allocator over a 1MiB region")
+	{
+		Nz::TLSFAllocator allocator(region.get(), RegionSize);
+		CHECK(allocator.GetAllocatedSize() == 0);
+		CHECK(allocator.CheckIntegrity());
+
+		WHEN("We allocate memory")
+		{
+			void* ptr1 = allocator.Allocate(100);
+			void* ptr2 = allocator.Allocate(1);
+			void* ptr3 = allocator.Allocate(5000);
+			REQUIRE(ptr1);
+			REQUIRE(ptr2);
+			REQUIRE(ptr3);
+			CHECK(allocator.CheckIntegrity());
+
+			CHECK(Nz::TLSFAllocator::GetAllocationSize(ptr1) >= 100);
+			CHECK(Nz::TLSFAllocator::GetAllocationSize(ptr2) >= 1);
+			CHECK(Nz::TLSFAllocator::GetAllocationSize(ptr3) >= 5000);
+			CHECK(allocator.GetAllocatedSize() == Nz::TLSFAllocator::GetAllocationSize(ptr1) + Nz::TLSFAllocator::GetAllocationSize(ptr2) + Nz::TLSFAllocator::GetAllocationSize(ptr3));
+
+			for (void* ptr : { ptr1, ptr2, ptr3 })
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr) >= reinterpret_cast<std::uintptr_t>(region.get()));
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr) < reinterpret_cast<std::uintptr_t>(region.get()) + RegionSize);
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr) % Nz::TLSFAllocator::Alignment == 0);
+			}
+
+			AND_WHEN("We free it")
+			{
+				allocator.Free(ptr2);
+				CHECK(allocator.CheckIntegrity());
+				allocator.Free(ptr1);
+				CHECK(allocator.CheckIntegrity());
+				allocator.Free(ptr3);
+				CHECK(allocator.CheckIntegrity());
+
+				CHECK(allocator.GetAllocatedSize() == 0);
+
+				THEN("Free blocks have been merged back")
+				{
+					void* ptr = allocator.Allocate(RegionSize / 2);
+					CHECK(ptr);
+					allocator.Free(ptr);
+				}
+			}
+		}
+
+		WHEN("We allocate with big alignments")
+		{
+			std::vector<void*> allocations;
+			for (std::size_t alignment : { 32, 64, 256, 4096, 8, 128 })
+			{
+				void* ptr = allocator.Allocate(24, alignment);
+				REQUIRE(ptr);
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+				allocations.push_back(ptr);
+
+				CHECK(allocator.CheckIntegrity());
+			}
+
+			for (void* ptr : allocations)
+				allocator.Free(ptr);
+
+			CHECK(allocator.CheckIntegrity());
+			CHECK(allocator.GetAllocatedSize() == 0);
+		}
+
+		WHEN("We reallocate memory")
+		{
+			std::uint8_t* ptr = static_cast<std::uint8_t*>(allocator.Allocate(64));
+			for (std::size_t i = 0; i < 64; ++i)
+				ptr[i] = std::uint8_t(i);
+
+			AND_WHEN("The next block is free")
+			{
+				std::uint8_t* grown = static_cast<std::uint8_t*>(allocator.Reallocate(ptr, 1000));
+				CHECK(grown == ptr);
+				CHECK(Nz::TLSFAllocator::GetAllocationSize(grown) >= 1000);
+				CHECK(allocator.CheckIntegrity());
+
+				std::uint8_t* shrunk = static_cast<std::uint8_t*>(allocator.Reallocate(grown, 32));
+				CHECK(shrunk == ptr);
+				CHECK(allocator.CheckIntegrity());
+
+				for (std::size_t i = 0; i < 32; ++i)
+					CHECK(shrunk[i] == std::uint8_t(i));
+			}
+
+			AND_WHEN("The next block is used")
+			{
+				void* blocker = allocator.Allocate(16);
+
+				std::uint8_t* moved = static_cast<std::uint8_t*>(allocator.Reallocate(ptr, 1000));
+				CHECK(moved != ptr);
+				CHECK(allocator.CheckIntegrity());
+
+				bool intact = true;
+				for (std::size_t i = 0; i < 64; ++i)
+					intact &= (moved[i] == std::uint8_t(i));
+
+				CHECK(intact);
+
+				allocator.Free(moved);
+				allocator.Free(blocker);
+				CHECK(allocator.GetAllocatedSize() == 0);
+			}
+
+			AND_WHEN("We reallocate more than the region size")
+			{
+				CHECK(allocator.Reallocate(ptr, RegionSize) == nullptr);
+				CHECK(ptr[63] == 63);
+			}
+		}
+
+		WHEN("We exhaust the region")
+		{
+			std::vector<void*> allocations;
+			while (void* ptr = allocator.Allocate(1000))
+				allocations.push_back(ptr);
+
+			CHECK(allocations.size() > RegionSize / 1100);
+			CHECK(allocator.Allocate(1000) == nullptr);
+			CHECK(allocator.CheckIntegrity());
+
+			for (void* ptr : allocations)
+				allocator.Free(ptr);
+
+			CHECK(allocator.CheckIntegrity());
+			CHECK(allocator.GetAllocatedSize() == 0);
+		}
+
+		WHEN("We perform random operations")
+		{
+			struct Allocation
+			{
+				std::uint8_t* ptr;
+				std::size_t size;
+				std::uint8_t value;
+			};
+
+			std::mt19937 randomEngine(1337);
+			std::uniform_int_distribution<std::size_t> sizeDis(1, 4096);
+			std::uniform_int_distribution<int> opDis(0, 2);
+
+			std::vector<Allocation> allocations;
+			bool success = true;
+			for (std::size_t i = 0; i < 5000; ++i)
+			{
+				int op = (allocations.empty()) ? 0 : opDis(randomEngine);
+				switch (op)
+				{
+					case 0:
+					{
+						std::size_t size = sizeDis(randomEngine);
+						std::uint8_t* ptr = static_cast<std::uint8_t*>(allocator.Allocate(size, std::size_t(1) << (i % 8)));
+						if (ptr)
+						{
+							std::memset(ptr, int(i % 256), size);
+							allocations.push_back({ ptr, size, std::uint8_t(i % 256) });
+						}
+						break;
+					}
+
+					case 1:
+					{
+						std::size_t index = i % allocations.size();
+						const Allocation& allocation = allocations[index];
+						for (std::size_t j = 0; j < allocation.size; ++j)
+							success &= (allocation.ptr[j] == allocation.value);
+
+						allocator.Free(allocation.ptr);
+						allocations.erase(allocations.begin() + index);
+						break;
+					}
+
+					case 2:
+					{
+						Allocation& allocation = allocations[i % allocations.size()];
+						std::size_t newSize = sizeDis(randomEngine);
+						std::uint8_t* ptr = static_cast<std::uint8_t*>(allocator.Reallocate(allocation.ptr, newSize));
+						if (ptr)
+						{
+							for (std::size_t j = 0; j < std::min(allocation.size, newSize); ++j)
+								success &= (ptr[j] == allocation.value);
+
+							std::memset(ptr, allocation.value, newSize);
+							allocation.ptr = ptr;
+							allocation.size = newSize;
+						}
+						break;
+					}
+				}
+
+				if (i % 100 == 0)
+					success &= allocator.CheckIntegrity();
+			}
+
+			CHECK(success);
+			CHECK(allocator.CheckIntegrity());
+
+			for (const Allocation& allocation : allocations)
+				allocator.Free(allocation.ptr);
+
+			CHECK(allocator.CheckIntegrity());
+			CHECK(allocator.GetAllocatedSize() == 0);
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include <NazaraUtils/MemoryPool.hpp>
+#include <NazaraUtils/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::size_t Fibonacci(Nz::TaskScheduler& scheduler, std::size_t n)
+	{
+		if (n < 2)
+			return n;
+
+		std::size_t a, b;
+
+		Nz::TaskScheduler::Counter counter;
+		scheduler.AddTask([&] { a = Fibonacci(scheduler, n - 1); }, &counter);
+		b = Fibonacci(scheduler, n - 2);
+		scheduler.WaitFor(counter);
+
+		return a + b;
+	}
+}
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("A scheduler with four workers")
+	{
+		Nz::TaskScheduler scheduler(4);
+		CHECK(scheduler.GetWorkerCount() == 4);
+
+		WHEN("Adding many tasks from this thread")
+		{
+			constexpr std::size_t taskCount = 10'000;
+
+			std::vector<std::atomic<unsigned int>> executionCount(taskCount);
+
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < taskCount; ++i)
+				scheduler.AddTask([&executionCount, i] { executionCount[i]++; }, &counter);
+
+			scheduler.WaitFor(counter);
+
+			CHECK(counter.IsDone());
+			CHECK(std::all_of(executionCount.begin(), executionCount.end(), [](const std::atomic<unsigned int>& count) { return count == 1; }));
+		}
+
+		WHEN("Tasks spawn and wait on other tasks")
+		{
+			CHECK(Fibonacci(scheduler, 20) == 6765);
+		}
+
+		WHEN("Adding tasks from several threads")
+		{
+			std::atomic<std::size_t> sum(0);
+
+			std::vector<std::thread> threads;
+			for (std::size_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+			{
+				threads.emplace_back([&]
+				{
+					Nz::TaskScheduler::Counter counter;
+					for (std::size_t i = 1; i <= 1000; ++i)
+						scheduler.AddTask([&sum, i] { sum += i; }, &counter);
+
+					scheduler.WaitFor(counter);
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			CHECK(sum == 4 * 500'500);
+		}
+
+		WHEN("Using continuations")
+		{
+			std::mutex mutex;
+			std::vector<int> order;
+			auto Record = [&](int value)
+			{
+				std::lock_guard lock(mutex);
+				order.push_back(value);
+			};
+
+			Nz::TaskScheduler::Counter counter;
+			Nz::TaskScheduler::Task* first = scheduler.CreateTask([&] { Record(1); });
+			Nz::TaskScheduler::Task* second = scheduler.CreateTask([&] { Record(1); });
+			Nz::TaskScheduler::Task* join = scheduler.CreateTask([&] { Record(2); });
+			Nz::TaskScheduler::Task* last = scheduler.CreateTask([&] { Record(3); }, &counter);
+
+			scheduler.SetContinuation(first, join);
+			scheduler.SetContinuation(second, join);
+			scheduler.SetContinuation(join, last);
+
+			scheduler.Submit(last);
+			scheduler.Submit(join);
+			scheduler.Submit(first);
+			scheduler.Submit(second);
+
+			scheduler.WaitFor(counter);
+
+			CHECK(order == std::vector<int>{ 1, 1, 2, 3 });
+		}
+
+		WHEN("Captured resources are released once the task has been executed")
+		{
+			auto resource = std::make_shared<int>(42);
+			std::weak_ptr<int> weakResource = resource;
+
+			std::atomic_int value(0);
+			Nz::TaskScheduler::Counter counter;
+			scheduler.AddTask([&value, resource = std::move(resource)] { value = *resource; }, &counter);
+			scheduler.WaitFor(counter);
+
+			CHECK(value == 42);
+			CHECK(weakResource.expired());
+		}
+
+		WHEN("Using it as an executor")
+		{
+			Nz::MemoryPool<int> memoryPool(16);
+			std::size_t index;
+			for (int i = 1; i <= 100; ++i)
+				memoryPool.Allocate(index, i);
+
+			std::atomic_int sum(0);
+			memoryPool.ParallelForEach(scheduler, [&](int value)
+			{
+				sum += value;
+			});
+
+			CHECK(sum == 5050);
+		}
+	}
+
+	GIVEN("A scheduler destroyed with pending tasks")
+	{
+		std::atomic_int executedCount(0);
+		{
+			Nz::TaskScheduler scheduler(2);
+			for (int i = 0; i < 100; ++i)
+				scheduler.AddTask([&] { executedCount++; });
+		}
+
+		CHECK(executedCount == 100);
+	}
+}
@@ -1,7 +1,16 @@
+#include <NazaraUtils/MovablePtr.hpp>
 #include <NazaraUtils/TypeTraits.hpp>
+#include <string>
 
 // This is a compilation test
 
 int foo(double, float);
 
-static_assert(std::is_same_v<Nz::FunctionPtr<int(double, float)>, decltype(&foo)>);
\ No newline at end of file
+static_assert(std::is_same_v<Nz::FunctionPtr<int(double, float)>, decltype(&foo)>);
+
+static_assert(Nz::IsTriviallyRelocatable_v<int>);
+static_assert(Nz::IsTriviallyRelocatable_v<float*>);
+static_assert(Nz::IsTriviallyRelocatable_v<std::unique_ptr<int>>);
+static_assert(Nz::IsTriviallyRelocatable_v<std::shared_ptr<int>>);
+static_assert(Nz::IsTriviallyRelocatable_v<Nz::MovablePtr<int>>);
+static_assert(!Nz::IsTriviallyRelocatable_v<std::string>);